@@ -74,7 +74,7 @@ target_link_libraries(${PROJECT_NAME}_lib
         ${LUAJIT_LIBRARIES}
         CURL::libcurl
         ZLIB::ZLIB
-        absl::any absl::log absl::base absl::bits
+        absl::any absl::log absl::base absl::bits absl::inlined_vector
         asio::asio
         eventpp::eventpp
         fmt::fmt
@@ -103,6 +103,10 @@ if(FEATURE_METRICS)
     )
 endif()
 
+if(FEATURE_KV_LOG)
+    add_definitions(-DFEATURE_KV_LOG)
+endif()
+
 if(CMAKE_BUILD_TYPE MATCHES Debug)
     target_link_libraries(${PROJECT_NAME}_lib PUBLIC ${ZLIB_LIBRARY_DEBUG})
 else()
@@ -32,7 +32,7 @@ function ban.onSay(player, words, param)
 	end
 
 	local timeNow = os.time()
-	db.query("INSERT INTO `account_bans` (`account_id`, `reason`, `banned_at`, `expires_at`, `banned_by`) VALUES (" .. accountId .. ", " .. db.escapeString(reason) .. ", " .. timeNow .. ", " .. timeNow + (banDays * 86400) .. ", " .. player:getGuid() .. ")")
+	Game.addAccountBan(accountId, reason, timeNow + (banDays * 86400), player)
 
 	local target = Player(name)
 	if target then
@@ -14,8 +14,8 @@ function unban.onSay(player, words, param)
 		return true
 	end
 
-	db.asyncQuery("DELETE FROM `account_bans` WHERE `account_id` = " .. Result.getNumber(resultId, "account_id"))
-	db.asyncQuery("DELETE FROM `ip_bans` WHERE `ip` = " .. Result.getNumber(resultId, "lastip"))
+	Game.removeAccountBan(Result.getNumber(resultId, "account_id"))
+	Game.removeIpBan(Result.getNumber(resultId, "lastip"))
 	Result.free(resultId)
 	local text = param .. " has been unbanned."
 	player:sendTextMessage(MESSAGE_ADMINISTRATOR, text)
@@ -12,6 +12,7 @@
 #include "declarations.hpp"
 #include "creatures/players/grouping/familiars.hpp"
 #include "creatures/players/storages/storages.hpp"
+#include "creatures/players/management/ban.hpp"
 #include "database/databasemanager.hpp"
 #include "game/game.hpp"
 #include "game/zones/zone.hpp"
@@ -19,8 +20,10 @@
 #include "game/scheduling/events_scheduler.hpp"
 #include "io/iomarket.hpp"
 #include "lib/thread/thread_pool.hpp"
+#include "lib/thread/task_graph.hpp"
 #include "lua/creature/events.hpp"
 #include "lua/modules/modules.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
 #include "lua/scripts/lua_environment.hpp"
 #include "lua/scripts/scripts.hpp"
 #include "server/network/protocol/protocollogin.hpp"
@@ -318,6 +321,9 @@ void CanaryServer::initializeDatabase() {
 
 	DatabaseManager::updateDatabase();
 
+	logger.debug("Loading bans...");
+	IOBan::loadBans();
+
 	if (g_configManager().getBoolean(OPTIMIZE_DATABASE)
 	    && !DatabaseManager::optimizeTables()) {
 		logger.debug("No tables were optimized");
@@ -337,24 +343,34 @@ void CanaryServer::loadModules() {
 		));
 	}
 
+	Benchmark bm_loadModules;
+
 	logger.debug("Initializing lua environment...");
 	if (!g_luaEnvironment().getLuaState()) {
 		g_luaEnvironment().initState();
 	}
 
 	auto coreFolder = g_configManager().getString(CORE_DIRECTORY);
-	// Load appearances.dat first
-	modulesLoadHelper((g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") == ERROR_NONE), "appearances.dat");
+	// Asset loaders that don't touch the Lua state run concurrently, each one waiting only for what it depends on
+	TaskGraph assetLoaders(inject<ThreadPool>());
+	assetLoaders.add("appearances.dat", [&coreFolder] {
+		return g_game().loadAppearanceProtobuf(coreFolder + "/items/appearances.dat") == ERROR_NONE;
+	});
+	assetLoaders.add("XML/vocations.xml", [] { return g_vocations().loadFromXml(); });
+	// Outfits are checked against the looktypes registered by appearances.dat
+	assetLoaders.add("XML/outfits.xml", [] { return Outfits::getInstance().loadFromXml(); }, { "appearances.dat" });
+	assetLoaders.add("XML/familiars.xml", [] { return Familiars::getInstance().loadFromXml(); });
+	assetLoaders.add("XML/imbuements.xml", [] { return g_imbuements().loadFromXml(); });
+	assetLoaders.add("XML/storages.xml", [] { return g_storages().loadFromXML(); });
+	// items.xml extends the item types created from appearances.dat, and the move events
+	// and weapons it registers resolve their vocation restrictions by name
+	assetLoaders.add("items.xml", [] { return Item::items.loadFromXml(); }, { "appearances.dat", "XML/vocations.xml" });
+	for (const auto &failedLoader : assetLoaders.run()) {
+		modulesLoadHelper(false, failedLoader);
+	}
 
-	// Load XML folder dependencies (order matters)
-	modulesLoadHelper(g_vocations().loadFromXml(), "XML/vocations.xml");
+	// Loads event scheduler scripts, so it has to run on the Lua thread
 	modulesLoadHelper(g_eventsScheduler().loadScheduleEventFromXml(), "XML/events.xml");
-	modulesLoadHelper(Outfits::getInstance().loadFromXml(), "XML/outfits.xml");
-	modulesLoadHelper(Familiars::getInstance().loadFromXml(), "XML/familiars.xml");
-	modulesLoadHelper(g_imbuements().loadFromXml(), "XML/imbuements.xml");
-	modulesLoadHelper(g_storages().loadFromXML(), "XML/storages.xml");
-
-	modulesLoadHelper(Item::items.loadFromXml(), "items.xml");
 
 	const auto datapackFolder = g_configManager().getString(DATA_DIRECTORY);
 	logger.debug("Loading core scripts on folder: {}/", coreFolder);
@@ -375,10 +391,16 @@ void CanaryServer::loadModules() {
 	modulesLoadHelper(g_scripts().loadScripts(datapackFolder + "/monster", false, false), datapackFolder + "/monster");
 	modulesLoadHelper((g_npcs().load(false, true)), "npc");
 
+	if (const auto pruned = g_luaBytecodeCache().prune(); pruned > 0) {
+		logger.debug("Removed {} unused files from the Lua bytecode cache", pruned);
+	}
+
 	g_game().loadBoostedCreature();
 	g_ioBosstiary().loadBoostedBoss();
 	g_ioprey().initializeTaskHuntOptions();
 	g_game().logCyclopediaStats();
+
+	logger.info("Modules loaded in {} milliseconds", bm_loadModules.duration());
 }
 
 void CanaryServer::modulesLoadHelper(bool loaded, std::string moduleName) {
@@ -131,6 +131,7 @@ enum ConfigKey_t : uint16_t {
 	LOYALTY_POINTS_PER_CREATION_DAY,
 	LOYALTY_POINTS_PER_PREMIUM_DAY_PURCHASED,
 	LOYALTY_POINTS_PER_PREMIUM_DAY_SPENT,
+	LUA_BYTECODE_CACHE,
 	M_CONST,
 	MAINTAIN_MODE_MESSAGE,
 	MAP_AUTHOR,
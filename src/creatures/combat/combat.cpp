@@ -24,6 +24,54 @@
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
 
+namespace {
+	// Buffers of an area combat, kept between casts so they don't allocate again
+	struct CombatScratch {
+		std::vector<std::shared_ptr<Tile>> tiles;
+		std::vector<std::shared_ptr<Tile>> combatTiles;
+		std::vector<std::pair<size_t, std::shared_ptr<Creature>>> targets;
+		CreatureVector creatures;
+	};
+
+	// Combat callbacks may cast again, so each cast in progress leases its own buffers
+	class CombatScratchLease {
+	public:
+		CombatScratchLease() {
+			auto &freeList = getFreeList();
+			if (freeList.empty()) {
+				scratch = std::make_unique<CombatScratch>();
+			} else {
+				scratch = std::move(freeList.back());
+				freeList.pop_back();
+			}
+		}
+
+		~CombatScratchLease() {
+			// Only the capacity is kept, not the tiles and creatures
+			scratch->tiles.clear();
+			scratch->combatTiles.clear();
+			scratch->targets.clear();
+			scratch->creatures.clear();
+			getFreeList().emplace_back(std::move(scratch));
+		}
+
+		CombatScratchLease(const CombatScratchLease &) = delete;
+		CombatScratchLease &operator=(const CombatScratchLease &) = delete;
+
+		CombatScratch* operator->() const {
+			return scratch.get();
+		}
+
+	private:
+		static std::vector<std::unique_ptr<CombatScratch>> &getFreeList() {
+			static thread_local std::vector<std::unique_ptr<CombatScratch>> freeList;
+			return freeList;
+		}
+
+		std::unique_ptr<CombatScratch> scratch;
+	};
+}
+
 int32_t Combat::getLevelFormula(std::shared_ptr<Player> player, const std::shared_ptr<Spell> wheelSpell, const CombatDamage &damage) const {
 	if (!player) {
 		return 0;
@@ -1128,7 +1176,8 @@ bool Combat::doCombat(std::shared_ptr<Creature> caster, const Position &position
 }
 
 void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin, const Position &pos, const std::unique_ptr<AreaCombat> &area, const CombatParams &params, CombatFunction func, CombatDamage* data) {
-	std::vector<std::shared_ptr<Tile>> tileList;
+	const CombatScratchLease scratch;
+	auto &tileList = scratch->tiles;
 
 	if (caster) {
 		getCombatArea(caster->getPosition(), pos, area, tileList);
@@ -1157,16 +1206,20 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 	const int32_t rangeX = maxX + MAP_MAX_VIEW_PORT_X;
 	const int32_t rangeY = maxY + MAP_MAX_VIEW_PORT_Y;
 
-	int affected = 0;
+	// Tiles and targets are collected in a single pass, since the affected count is needed before applying the combat
+	auto &combatTiles = scratch->combatTiles;
+	auto &targets = scratch->targets;
 	for (const std::shared_ptr<Tile> &tile : tileList) {
 		if (canDoCombat(caster, tile, params.aggressive) != RETURNVALUE_NOERROR) {
 			continue;
 		}
 
+		combatTiles.emplace_back(tile);
 		if (CreatureVector* creatures = tile->getCreatures()) {
 			const std::shared_ptr<Creature> topCreature = tile->getTopCreature();
 			// A copy of the tile's creature list is made because modifications to this vector, such as adding or removing creatures through a Lua callback, may occur during the iteration within the for loop.
-			CreatureVector creaturesCopy = *creatures;
+			auto &creaturesCopy = scratch->creatures;
+			creaturesCopy.assign(creatures->begin(), creatures->end());
 			for (auto &creature : creaturesCopy) {
 				if (params.targetCasterOrTopMost) {
 					if (caster && caster->getTile() == tile) {
@@ -1179,12 +1232,14 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 				}
 
 				if (!params.aggressive || (caster != creature && Combat::canDoCombat(caster, creature, params.aggressive) == RETURNVALUE_NOERROR)) {
-					affected++;
+					targets.emplace_back(combatTiles.size() - 1, creature);
 				}
 			}
 		}
 	}
 
+	const auto affected = static_cast<int>(targets.size());
+
 	CombatDamage tmpDamage;
 	if (data) {
 		tmpDamage.origin = data->origin;
@@ -1215,40 +1270,23 @@ void Combat::CombatFunc(std::shared_ptr<Creature> caster, const Position &origin
 	uint8_t beamAffectedCurrent = 0;
 
 	tmpDamage.affected = affected;
-	for (const std::shared_ptr<Tile> &tile : tileList) {
-		if (canDoCombat(caster, tile, params.aggressive) != RETURNVALUE_NOERROR) {
-			continue;
-		}
-
-		if (CreatureVector* creatures = tile->getCreatures()) {
-			const std::shared_ptr<Creature> topCreature = tile->getTopCreature();
-			// A copy of the tile's creature list is made because modifications to this vector, such as adding or removing creatures through a Lua callback, may occur during the iteration within the for loop.
-			CreatureVector creaturesCopy = *creatures;
-			for (auto &creature : creaturesCopy) {
-				if (params.targetCasterOrTopMost) {
-					if (caster && caster->getTile() == tile) {
-						if (creature != caster) {
-							continue;
-						}
-					} else if (creature != topCreature) {
-						continue;
-					}
-				}
-
-				if (!params.aggressive || (caster != creature && Combat::canDoCombat(caster, creature, params.aggressive) == RETURNVALUE_NOERROR)) {
-					// Wheel of destiny update beam mastery damage
-					if (casterPlayer) {
-						casterPlayer->wheel()->updateBeamMasteryDamage(tmpDamage, beamAffectedTotal, beamAffectedCurrent);
-					}
-					func(caster, creature, params, &tmpDamage);
-					if (params.targetCallback) {
-						params.targetCallback->onTargetCombat(caster, creature);
-					}
+	auto targetIt = targets.begin();
+	for (size_t tileIndex = 0; tileIndex < combatTiles.size(); ++tileIndex) {
+		const std::shared_ptr<Tile> &tile = combatTiles[tileIndex];
+		for (; targetIt != targets.end() && targetIt->first == tileIndex; ++targetIt) {
+			const std::shared_ptr<Creature> &creature = targetIt->second;
+			// Combat callbacks of previous targets may have killed or moved this creature
+			if (creature->isRemoved() || creature->getTile() != tile) {
+				continue;
+			}
 
-					if (params.targetCasterOrTopMost) {
-						break;
-					}
-				}
+			// Wheel of destiny update beam mastery damage
+			if (casterPlayer) {
+				casterPlayer->wheel()->updateBeamMasteryDamage(tmpDamage, beamAffectedTotal, beamAffectedCurrent);
+			}
+			func(caster, creature, params, &tmpDamage);
+			if (params.targetCallback) {
+				params.targetCallback->onTargetCombat(caster, creature);
 			}
 		}
 		combatTileEffects(spectators.data(), caster, tile, params);
@@ -1827,12 +1865,32 @@ bool ChainPickerCallback::onChainCombat(std::shared_ptr<Creature> creature, std:
 
 //**********************************************************//
 
+AreaMask::AreaMask(const MatrixArea &area) :
+	rows(area.getRows()), wordsPerRow((area.getCols() + 63) / 64) {
+	area.getCenter(centerY, centerX);
+	masks.resize(static_cast<size_t>(rows) * wordsPerRow);
+
+	const uint32_t cols = area.getCols();
+	for (uint32_t y = 0; y < rows; ++y) {
+		for (uint32_t x = 0; x < cols; ++x) {
+			if (area.getValue(y, x)) {
+				masks[y * wordsPerRow + x / 64] |= uint64_t { 1 } << (x % 64);
+				++tileCount;
+			}
+		}
+	}
+}
+
+//**********************************************************//
+
 void AreaCombat::clear() {
 	std::ranges::fill(areas, nullptr);
+	std::ranges::fill(masks, AreaMask());
 }
 
 AreaCombat::AreaCombat(const AreaCombat &rhs) {
 	hasExtArea = rhs.hasExtArea;
+	masks = rhs.masks;
 	for (uint_fast8_t i = 0; i <= Direction::DIRECTION_LAST; ++i) {
 		if (const auto &area = rhs.areas[i]) {
 			areas[i] = area->clone();
@@ -1840,30 +1898,25 @@ AreaCombat::AreaCombat(const AreaCombat &rhs) {
 	}
 }
 
+void AreaCombat::compileMasks() {
+	for (uint_fast8_t i = 0; i <= Direction::DIRECTION_LAST; ++i) {
+		masks[i] = areas[i] ? AreaMask(*areas[i]) : AreaMask();
+	}
+}
+
 void AreaCombat::getList(const Position &centerPos, const Position &targetPos, std::vector<std::shared_ptr<Tile>> &list) const {
-	const std::unique_ptr<MatrixArea> &area = getArea(centerPos, targetPos);
-	if (!area) {
+	const AreaMask &mask = getMask(centerPos, targetPos);
+	if (mask.empty()) {
 		return;
 	}
 
-	uint32_t centerY;
-	uint32_t centerX;
-	area->getCenter(centerY, centerX);
-
-	const uint32_t rows = area->getRows();
-	const uint32_t cols = area->getCols();
-	list.reserve(rows * cols);
-
-	Position tmpPos(targetPos.x - centerX, targetPos.y - centerY, targetPos.z);
-	for (uint32_t y = 0; y < rows; ++y, ++tmpPos.y, tmpPos.x -= cols) {
-		for (uint32_t x = 0; x < cols; ++x, ++tmpPos.x) {
-			if (area->getValue(y, x) != 0) {
-				if (g_game().isSightClear(targetPos, tmpPos, true)) {
-					list.emplace_back(g_game().map.getOrCreateTile(tmpPos));
-				}
-			}
+	list.reserve(list.size() + mask.getTileCount());
+	mask.forEachOffset([&](int32_t offsetX, int32_t offsetY) {
+		const Position tilePos(static_cast<uint16_t>(targetPos.x + offsetX), static_cast<uint16_t>(targetPos.y + offsetY), targetPos.z);
+		if (g_game().isSightClear(targetPos, tilePos, true)) {
+			list.emplace_back(g_game().map.getOrCreateTile(tilePos));
 		}
-	}
+	});
 }
 
 void AreaCombat::copyArea(const std::unique_ptr<MatrixArea> &input, const std::unique_ptr<MatrixArea> &output, MatrixOperation_t op) const {
@@ -1997,6 +2050,8 @@ void AreaCombat::setupArea(const std::list<uint32_t> &list, uint32_t rows) {
 	areas[DIRECTION_SOUTH] = std::move(southArea);
 	areas[DIRECTION_EAST] = std::move(eastArea);
 	areas[DIRECTION_WEST] = std::move(westArea);
+
+	compileMasks();
 }
 
 void AreaCombat::setupArea(int32_t length, int32_t spread) {
@@ -2095,6 +2150,8 @@ void AreaCombat::setupExtArea(const std::list<uint32_t> &list, uint32_t rows) {
 	areas[DIRECTION_SOUTHWEST] = std::move(swArea);
 	areas[DIRECTION_NORTHEAST] = std::move(neArea);
 	areas[DIRECTION_SOUTHEAST] = std::move(seArea);
+
+	compileMasks();
 }
 
 //**********************************************************//
@@ -206,6 +206,48 @@ private:
 	bool** data_;
 };
 
+/**
+ * @brief Bit-packed, read-only copy of a MatrixArea, compiled once when the area is set up.
+ * Every row is stored as 64-bit words so casting only walks the set bits.
+ */
+class AreaMask {
+public:
+	AreaMask() = default;
+	explicit AreaMask(const MatrixArea &area);
+
+	bool empty() const {
+		return tileCount == 0;
+	}
+	uint32_t getTileCount() const {
+		return tileCount;
+	}
+
+	/**
+	 * @brief Calls func(offsetX, offsetY) for every affected tile, relative to the area center, row by row.
+	 */
+	template <typename F>
+	void forEachOffset(F &&func) const {
+		for (uint32_t row = 0; row < rows; ++row) {
+			for (uint32_t word = 0; word < wordsPerRow; ++word) {
+				uint64_t bits = masks[row * wordsPerRow + word];
+				while (bits != 0) {
+					const auto col = static_cast<int32_t>(word * 64 + std::countr_zero(bits));
+					func(col - static_cast<int32_t>(centerX), static_cast<int32_t>(row) - static_cast<int32_t>(centerY));
+					bits &= bits - 1;
+				}
+			}
+		}
+	}
+
+private:
+	std::vector<uint64_t> masks;
+	uint32_t rows = 0;
+	uint32_t wordsPerRow = 0;
+	uint32_t centerX = 0;
+	uint32_t centerY = 0;
+	uint32_t tileCount = 0;
+};
+
 class AreaCombat {
 public:
 	AreaCombat() = default;
@@ -234,7 +276,9 @@ private:
 	std::unique_ptr<MatrixArea> createArea(const std::list<uint32_t> &list, uint32_t rows);
 	void copyArea(const std::unique_ptr<MatrixArea> &input, const std::unique_ptr<MatrixArea> &output, MatrixOperation_t op) const;
 
-	const std::unique_ptr<MatrixArea> &getArea(const Position &centerPos, const Position &targetPos) const {
+	void compileMasks();
+
+	const AreaMask &getMask(const Position &centerPos, const Position &targetPos) const {
 		int32_t dx = Position::getOffsetX(targetPos, centerPos);
 		int32_t dy = Position::getOffsetY(targetPos, centerPos);
 
@@ -261,10 +305,11 @@ private:
 			}
 		}
 
-		return areas[dir];
+		return masks[dir];
 	}
 
 	std::array<std::unique_ptr<MatrixArea>, Direction::DIRECTION_LAST + 1> areas {};
+	std::array<AreaMask, Direction::DIRECTION_LAST + 1> masks {};
 	bool hasExtArea = false;
 };
 
@@ -21,6 +21,7 @@ bool Condition::setParam(ConditionParam_t param, int32_t value) {
 	switch (param) {
 		case CONDITION_PARAM_TICKS: {
 			ticks = value;
+			resetOwnerExecution();
 			return true;
 		}
 
@@ -41,6 +42,7 @@ bool Condition::setParam(ConditionParam_t param, int32_t value) {
 
 		case CONDITION_PARAM_SOUND_TICK: {
 			tickSound = static_cast<SoundEffect_t>(value);
+			resetOwnerExecution();
 			return true;
 		}
 
@@ -176,6 +178,13 @@ void Condition::serialize(PropWriteStream &propWriteStream) {
 void Condition::setTicks(int32_t newTicks) {
 	ticks = newTicks;
 	endTime = ticks + OTSYS_TIME();
+	resetOwnerExecution();
+}
+
+void Condition::resetOwnerExecution() const {
+	if (const auto creature = owner.lock()) {
+		creature->resetConditionExecution();
+	}
 }
 
 bool Condition::executeCondition(std::shared_ptr<Creature> creature, int32_t interval) {
@@ -184,7 +193,7 @@ bool Condition::executeCondition(std::shared_ptr<Creature> creature, int32_t int
 	}
 
 	// Not using set ticks here since it would reset endTime
-	ticks = std::max<int32_t>(0, ticks - interval);
+	advanceTicks(interval);
 	if (getEndTime() < OTSYS_TIME()) {
 		return false;
 	}
@@ -196,6 +205,26 @@ bool Condition::executeCondition(std::shared_ptr<Creature> creature, int32_t int
 	return true;
 }
 
+int64_t Condition::getNextExecutionTime() const {
+	if (tickSound != SoundEffect_t::SILENCE) {
+		return 0;
+	}
+
+	if (ticks == -1) {
+		return std::numeric_limits<int64_t>::max();
+	}
+
+	return endTime;
+}
+
+void Condition::advanceTicks(int32_t interval) {
+	if (ticks == -1) {
+		return;
+	}
+
+	ticks = std::max<int32_t>(0, ticks - interval);
+}
+
 std::shared_ptr<Condition> Condition::createCondition(ConditionId_t id, ConditionType_t type, int32_t ticks, int32_t param /* = 0*/, bool buff /* = false*/, uint32_t subId /* = 0*/, bool isPersistent /* = false*/) {
 	switch (type) {
 		case CONDITION_POISON:
@@ -51,6 +51,31 @@ public:
 	}
 	void setTicks(int32_t newTicks);
 
+	/**
+	 * @brief Timestamp after which the condition has to be executed again.
+	 * @details Conditions without per-think effects only need to run once they expire,
+	 * so the owner skips them until then. Conditions with periodic effects return 0.
+	 */
+	virtual int64_t getNextExecutionTime() const;
+	/**
+	 * @brief Consumes ticks for think time skipped by the owner, without running any effect.
+	 */
+	void advanceTicks(int32_t interval);
+	int64_t getExecutionClock() const {
+		return executionClock;
+	}
+	void setExecutionClock(int64_t clock) {
+		executionClock = clock;
+	}
+	/**
+	 * @brief Creature whose condition list holds this condition.
+	 * @details The owner caches the earliest getNextExecutionTime() of its conditions,
+	 * so changing the ticks resets that cache on the owner only.
+	 */
+	void setOwner(const std::shared_ptr<Creature> &creature) {
+		owner = creature;
+	}
+
 	static std::shared_ptr<Condition> createCondition(ConditionId_t id, ConditionType_t type, int32_t ticks, int32_t param = 0, bool buff = false, uint32_t subId = 0, bool isPersistent = false);
 	static std::shared_ptr<Condition> createCondition(PropStream &propStream);
 
@@ -68,6 +93,8 @@ public:
 protected:
 	uint8_t drainBodyStage = 0;
 	int64_t endTime {};
+	// Owner think clock at the last execution, see Creature::executeConditions
+	int64_t executionClock {};
 	uint32_t subId {};
 	int32_t ticks {};
 	ConditionType_t conditionType {};
@@ -78,6 +105,10 @@ protected:
 	virtual bool updateCondition(std::shared_ptr<Condition> addCondition);
 
 private:
+	void resetOwnerExecution() const;
+
+	std::weak_ptr<Creature> owner;
+
 	SoundEffect_t tickSound = SoundEffect_t::SILENCE;
 	SoundEffect_t addSound = SoundEffect_t::SILENCE;
 
@@ -177,6 +208,9 @@ public:
 	void endCondition(std::shared_ptr<Creature> creature) override;
 	void addCondition(std::shared_ptr<Creature> creature, std::shared_ptr<Condition> addCondition) override;
 	bool executeCondition(std::shared_ptr<Creature> creature, int32_t interval) override;
+	int64_t getNextExecutionTime() const override {
+		return 0;
+	}
 
 	bool setParam(ConditionParam_t param, int32_t value) override;
 
@@ -232,6 +266,9 @@ public:
 
 	void addCondition(std::shared_ptr<Creature> creature, std::shared_ptr<Condition> addCondition) override;
 	bool executeCondition(std::shared_ptr<Creature> creature, int32_t interval) override;
+	int64_t getNextExecutionTime() const override {
+		return 0;
+	}
 
 	bool setParam(ConditionParam_t param, int32_t value) override;
 
@@ -272,6 +309,9 @@ public:
 
 	bool startCondition(std::shared_ptr<Creature> creature) override;
 	bool executeCondition(std::shared_ptr<Creature> creature, int32_t interval) override;
+	int64_t getNextExecutionTime() const override {
+		return 0;
+	}
 	void endCondition(std::shared_ptr<Creature> creature) override;
 	void addCondition(std::shared_ptr<Creature> creature, std::shared_ptr<Condition> condition) override;
 	std::unordered_set<PlayerIcon> getIcons() const override;
@@ -323,6 +363,9 @@ public:
 
 	bool startCondition(std::shared_ptr<Creature> creature) override;
 	bool executeCondition(std::shared_ptr<Creature> creature, int32_t interval) override;
+	int64_t getNextExecutionTime() const override {
+		return 0;
+	}
 	void endCondition(std::shared_ptr<Creature> creature) override;
 	void addCondition(std::shared_ptr<Creature> creature, std::shared_ptr<Condition> condition) override;
 	std::unordered_set<PlayerIcon> getIcons() const override;
@@ -423,6 +466,9 @@ public:
 
 	bool startCondition(std::shared_ptr<Creature> creature) override;
 	bool executeCondition(std::shared_ptr<Creature> creature, int32_t interval) override;
+	int64_t getNextExecutionTime() const override {
+		return 0;
+	}
 	void endCondition(std::shared_ptr<Creature> creature) override;
 	void addCondition(std::shared_ptr<Creature> creature, std::shared_ptr<Condition> addCondition) override;
 
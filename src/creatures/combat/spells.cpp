@@ -101,9 +101,39 @@ TalkActionResult_t Spells::playerSaySpell(std::shared_ptr<Player> player, std::s
 
 void Spells::clear() {
 	instants.clear();
+	instantWords.clear();
 	runes.clear();
 }
 
+void Spells::indexInstantWords(const std::string &words, const std::shared_ptr<InstantSpell> &instant) {
+	if (instantWords.empty()) {
+		instantWords.emplace_back();
+	}
+
+	uint32_t node = 0;
+	for (char ch : words) {
+		const char lower = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+		auto &children = instantWords[node].children;
+		auto it = std::ranges::find(children, lower, &std::pair<char, uint32_t>::first);
+		if (it != children.end()) {
+			node = it->second;
+			continue;
+		}
+
+		const auto child = static_cast<uint32_t>(instantWords.size());
+		children.emplace_back(lower, child);
+		// May reallocate instantWords, so children must not be used past this point
+		instantWords.emplace_back();
+		node = child;
+	}
+
+	// Words differing only in case share a node; keep the one the old map scan would have found first
+	auto &spell = instantWords[node].spell;
+	if (!spell || words < spell->getWords()) {
+		spell = instant;
+	}
+}
+
 bool Spells::hasInstantSpell(const std::string &word) const {
 	if (auto iterate = instants.find(word);
 	    iterate != instants.end()) {
@@ -205,15 +235,20 @@ std::shared_ptr<RuneSpell> Spells::getRuneSpellByName(const std::string &name) {
 std::shared_ptr<InstantSpell> Spells::getInstantSpell(const std::string &words) {
 	std::shared_ptr<InstantSpell> result = nullptr;
 
-	for (auto &it : instants) {
-		const std::string &instantSpellWords = it.second->getWords();
-		size_t spellLen = instantSpellWords.length();
-		if (strncasecmp(instantSpellWords.c_str(), words.c_str(), spellLen) == 0) {
-			if (!result || spellLen > result->getWords().length()) {
-				result = it.second;
-				if (words.length() == spellLen) {
-					break;
-				}
+	// Walk the words trie along the message, the deepest spell on the path is the longest match
+	if (!instantWords.empty()) {
+		uint32_t node = 0;
+		for (char ch : words) {
+			const char lower = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+			const auto &children = instantWords[node].children;
+			auto it = std::ranges::find(children, lower, &std::pair<char, uint32_t>::first);
+			if (it == children.end()) {
+				break;
+			}
+
+			node = it->second;
+			if (instantWords[node].spell) {
+				result = instantWords[node].spell;
 			}
 		}
 	}
@@ -59,7 +59,9 @@ public:
 	[[nodiscard]] bool hasInstantSpell(const std::string &word) const;
 
 	void setInstantSpell(const std::string &word, const std::shared_ptr<InstantSpell> instant) {
-		instants.try_emplace(word, instant);
+		if (instants.try_emplace(word, instant).second) {
+			indexInstantWords(word, instant);
+		}
 	}
 
 	void clear();
@@ -67,8 +69,22 @@ public:
 	bool registerRuneLuaEvent(std::shared_ptr<RuneSpell> rune);
 
 private:
+	/**
+	 * @brief Node of the case-insensitive prefix trie over the instant spell words.
+	 *
+	 * Children are few per node (letters that follow a prefix), so a linear scan beats a map.
+	 */
+	struct InstantWordsNode {
+		std::vector<std::pair<char, uint32_t>> children;
+		std::shared_ptr<InstantSpell> spell;
+	};
+
+	void indexInstantWords(const std::string &words, const std::shared_ptr<InstantSpell> &instant);
+
 	std::map<uint16_t, std::shared_ptr<RuneSpell>> runes;
 	std::map<std::string, std::shared_ptr<InstantSpell>> instants;
+	// Rebuilt alongside instants; node 0 is the root
+	std::vector<InstantWordsNode> instantWords;
 
 	friend class CombatSpell;
 };
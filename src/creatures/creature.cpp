@@ -1369,11 +1369,15 @@ bool Creature::addCondition(std::shared_ptr<Condition> condition, bool attackerP
 	std::shared_ptr<Condition> prevCond = getCondition(condition->getType(), condition->getId(), condition->getSubId());
 	if (prevCond) {
 		prevCond->addCondition(getCreature(), condition);
+		nextConditionExecution = 0;
 		return true;
 	}
 
 	if (condition->startCondition(getCreature())) {
+		condition->setExecutionClock(conditionsClock);
+		condition->setOwner(getCreature());
 		conditions.push_back(condition);
+		nextConditionExecution = 0;
 		onAddCondition(condition->getType());
 		return true;
 	}
@@ -1395,15 +1399,15 @@ bool Creature::addCombatCondition(std::shared_ptr<Condition> condition, bool att
 
 void Creature::removeCondition(ConditionType_t type) {
 	metrics::method_latency measure(__METHOD_NAME__);
-	auto it = conditions.begin(), end = conditions.end();
-	while (it != end) {
-		std::shared_ptr<Condition> condition = *it;
+	size_t index = 0;
+	while (index < conditions.size()) {
+		std::shared_ptr<Condition> condition = conditions[index];
 		if (condition->getType() != type) {
-			++it;
+			++index;
 			continue;
 		}
 
-		it = conditions.erase(it);
+		conditions.erase(conditions.begin() + index);
 
 		condition->endCondition(getCreature());
 
@@ -1413,11 +1417,11 @@ void Creature::removeCondition(ConditionType_t type) {
 
 void Creature::removeCondition(ConditionType_t conditionType, ConditionId_t conditionId, bool force /* = false*/) {
 	metrics::method_latency measure(__METHOD_NAME__);
-	auto it = conditions.begin(), end = conditions.end();
-	while (it != end) {
-		std::shared_ptr<Condition> condition = *it;
+	size_t index = 0;
+	while (index < conditions.size()) {
+		std::shared_ptr<Condition> condition = conditions[index];
 		if (condition->getType() != conditionType || condition->getId() != conditionId) {
-			++it;
+			++index;
 			continue;
 		}
 
@@ -1431,7 +1435,7 @@ void Creature::removeCondition(ConditionType_t conditionType, ConditionId_t cond
 			}
 		}
 
-		it = conditions.erase(it);
+		conditions.erase(conditions.begin() + index);
 
 		condition->endCondition(getCreature());
 
@@ -1467,6 +1471,7 @@ void Creature::removeCondition(std::shared_ptr<Condition> condition) {
 std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type) const {
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
+			syncConditionTicks(condition);
 			return condition;
 		}
 	}
@@ -1477,6 +1482,7 @@ std::shared_ptr<Condition> Creature::getCondition(ConditionType_t type, Conditio
 	metrics::method_latency measure(__METHOD_NAME__);
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type && condition->getId() == conditionId && condition->getSubId() == subId) {
+			syncConditionTicks(condition);
 			return condition;
 		}
 	}
@@ -1487,6 +1493,7 @@ std::vector<std::shared_ptr<Condition>> Creature::getConditionsByType(ConditionT
 	std::vector<std::shared_ptr<Condition>> conditionsVec;
 	for (const auto &condition : conditions) {
 		if (condition->getType() == type) {
+			syncConditionTicks(condition);
 			conditionsVec.push_back(condition);
 		}
 	}
@@ -1495,20 +1502,61 @@ std::vector<std::shared_ptr<Condition>> Creature::getConditionsByType(ConditionT
 
 void Creature::executeConditions(uint32_t interval) {
 	metrics::method_latency measure(__METHOD_NAME__);
-	auto it = conditions.begin(), end = conditions.end();
-	while (it != end) {
-		std::shared_ptr<Condition> condition = *it;
-		if (!condition->executeCondition(getCreature(), interval)) {
-			ConditionType_t type = condition->getType();
+	conditionsClock += interval;
 
-			it = conditions.erase(it);
+	const int64_t timeNow = OTSYS_TIME();
+	if (timeNow <= nextConditionExecution) {
+		return;
+	}
 
-			condition->endCondition(getCreature());
+	// Conditions added while iterating reset this to 0, forcing a full pass on the next think
+	nextConditionExecution = std::numeric_limits<int64_t>::max();
+	size_t index = 0;
+	while (index < conditions.size()) {
+		std::shared_ptr<Condition> condition = conditions[index];
+		const int64_t conditionExecution = condition->getNextExecutionTime();
+		if (timeNow <= conditionExecution) {
+			nextConditionExecution = std::min(nextConditionExecution, conditionExecution);
+			++index;
+			continue;
+		}
 
-			onEndCondition(type);
-		} else {
-			++it;
+		// Skipped conditions receive all the think time elapsed since their last execution
+		const auto elapsed = static_cast<int32_t>(conditionsClock - condition->getExecutionClock());
+		condition->setExecutionClock(conditionsClock);
+		if (condition->executeCondition(getCreature(), elapsed)) {
+			nextConditionExecution = std::min(nextConditionExecution, condition->getNextExecutionTime());
+			++index;
+			continue;
+		}
+
+		// The condition callbacks may have removed it already
+		const auto it = std::ranges::find(conditions, condition);
+		if (it == conditions.end()) {
+			continue;
 		}
+
+		ConditionType_t type = condition->getType();
+
+		conditions.erase(it);
+
+		condition->endCondition(getCreature());
+
+		onEndCondition(type);
+	}
+}
+
+void Creature::syncConditions() const {
+	for (const auto &condition : conditions) {
+		syncConditionTicks(condition);
+	}
+}
+
+void Creature::syncConditionTicks(const std::shared_ptr<Condition> &condition) const {
+	const int64_t elapsed = conditionsClock - condition->getExecutionClock();
+	if (elapsed > 0) {
+		condition->advanceTicks(static_cast<int32_t>(elapsed));
+		condition->setExecutionClock(conditionsClock);
 	}
 }
 
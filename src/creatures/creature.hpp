@@ -17,7 +17,7 @@
 #include "game/movement/position.hpp"
 #include "items/tile.hpp"
 
-using ConditionList = std::list<std::shared_ptr<Condition>>;
+using ConditionList = std::vector<std::shared_ptr<Condition>>;
 using CreatureEventList = std::list<std::shared_ptr<CreatureEvent>>;
 
 class Map;
@@ -406,6 +406,17 @@ public:
 	std::shared_ptr<Condition> getCondition(ConditionType_t type, ConditionId_t conditionId, uint32_t subId = 0) const;
 	std::vector<std::shared_ptr<Condition>> getConditionsByType(ConditionType_t type) const;
 	void executeConditions(uint32_t interval);
+	/**
+	 * @brief Settles the ticks of conditions skipped by executeConditions.
+	 * @note Must be called before reading or changing the ticks of conditions iterated directly.
+	 */
+	void syncConditions() const;
+	/**
+	 * @brief Forces the next executeConditions to rescan every condition.
+	 */
+	void resetConditionExecution() {
+		nextConditionExecution = 0;
+	}
 	bool hasCondition(ConditionType_t type, uint32_t subId = 0) const;
 
 	virtual bool isImmune([[maybe_unused]] CombatType_t type) const {
@@ -554,10 +565,9 @@ public:
 			position = newParent->getPosition();
 			m_tile = newParent;
 
-			if (newParent->getGround()) {
-				const auto &it = Item::items[newParent->getGround()->getID()];
-				if (it.speed > 0) {
-					walk.groundSpeed = it.speed;
+			if (const auto &ground = newParent->getGround()) {
+				if (const auto groundSpeed = Item::items.getSpeed(ground->getID()); groundSpeed > 0) {
+					walk.groundSpeed = groundSpeed;
 				}
 			}
 		}
@@ -727,6 +737,14 @@ protected:
 	std::vector<std::shared_ptr<Creature>> m_summons;
 	CreatureEventList eventsList;
 	ConditionList conditions;
+	// Think time consumed by executeConditions and the earliest timestamp at which a condition is due,
+	// reset by the conditions themselves when their ticks change
+	int64_t conditionsClock = 0;
+	int64_t nextConditionExecution = 0;
+
+	// Indexes in the creature and player lists of the map sector holding the creature, kept by MapSector
+	uint32_t sectorCreatureIndex = 0;
+	uint32_t sectorPlayerIndex = 0;
 
 	std::vector<Direction> listWalkDir;
 
@@ -834,11 +852,13 @@ protected:
 
 	friend class Game;
 	friend class Map;
+	friend class MapSector;
 	friend class CreatureFunctions;
 
 private:
 	bool canFollowMaster();
 	bool isLostSummon();
+	void syncConditionTicks(const std::shared_ptr<Condition> &condition) const;
 	void handleLostSummon(bool teleportSummons);
 
 	struct {
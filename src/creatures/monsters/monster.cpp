@@ -19,8 +19,6 @@
 int32_t Monster::despawnRange;
 int32_t Monster::despawnRadius;
 
-uint32_t Monster::monsterAutoID = 0x50000001;
-
 std::shared_ptr<Monster> Monster::createMonster(const std::string &name) {
 	const auto mType = g_monsters().getMonsterType(name);
 	if (!mType) {
@@ -55,6 +53,12 @@ Monster::Monster(const std::shared_ptr<MonsterType> mType) :
 	}
 }
 
+void Monster::setID() {
+	if (id == 0) {
+		id = g_game().reserveMonsterID();
+	}
+}
+
 void Monster::addList() {
 	g_game().addMonster(static_self_cast<Monster>());
 }
@@ -414,14 +418,17 @@ void Monster::addFriend(const std::shared_ptr<Creature> &creature) {
 	}
 
 	assert(creature != getMonster());
-	friendList.try_emplace(creature->getID(), creature);
+	const auto it = std::ranges::lower_bound(friendList, creature->getID());
+	if (it == friendList.end() || *it != creature->getID()) {
+		friendList.insert(it, creature->getID());
+	}
 }
 
 void Monster::removeFriend(const std::shared_ptr<Creature> &creature) {
-	std::erase_if(friendList, [id = creature->getID()](const auto &it) {
-		const auto &target = it.second.lock();
-		return !target || target->getID() == id;
-	});
+	const auto it = std::ranges::lower_bound(friendList, creature->getID());
+	if (it != friendList.end() && *it == creature->getID()) {
+		friendList.erase(it);
+	}
 }
 
 bool Monster::addTarget(const std::shared_ptr<Creature> &creature, bool pushFront /* = false*/) {
@@ -432,15 +439,14 @@ bool Monster::addTarget(const std::shared_ptr<Creature> &creature, bool pushFron
 
 	assert(creature != getMonster());
 
-	const auto &it = getTargetIterator(creature);
-	if (it != targetList.end()) {
+	if (hasTarget(creature->getID())) {
 		return false;
 	}
 
 	if (pushFront) {
-		targetList.emplace_front(creature);
+		targetList.insert(targetList.begin(), creature->getID());
 	} else {
-		targetList.emplace_back(creature);
+		targetList.emplace_back(creature->getID());
 	}
 
 	if (!getMaster() && getFaction() != FACTION_DEFAULT && creature->getPlayer()) {
@@ -455,7 +461,7 @@ bool Monster::removeTarget(const std::shared_ptr<Creature> &creature) {
 		return false;
 	}
 
-	const auto &it = getTargetIterator(creature);
+	const auto it = std::ranges::find(targetList, creature->getID());
 	if (it == targetList.end()) {
 		return false;
 	}
@@ -469,17 +475,46 @@ bool Monster::removeTarget(const std::shared_ptr<Creature> &creature) {
 	return true;
 }
 
-void Monster::updateTargetList() {
-	std::erase_if(friendList, [this](const auto &it) {
-		const auto &target = it.second.lock();
-		return !target || target->getHealth() <= 0 || !canSee(target->getPosition());
+CreatureVector Monster::getTargetList() {
+	CreatureVector list;
+	list.reserve(targetList.size());
+
+	std::erase_if(targetList, [&list](uint32_t creatureId) {
+		if (const auto &creature = g_game().getCreatureByID(creatureId)) {
+			list.emplace_back(creature);
+			return false;
+		}
+
+		return true;
 	});
 
-	std::erase_if(targetList, [this](const std::weak_ptr<Creature> &ref) {
-		const auto &target = ref.lock();
-		return !target || target->getHealth() <= 0 || !canSee(target->getPosition());
+	return list;
+}
+
+CreatureVector Monster::getFriendList() {
+	CreatureVector list;
+	list.reserve(friendList.size());
+
+	std::erase_if(friendList, [&list](uint32_t creatureId) {
+		if (const auto &creature = g_game().getCreatureByID(creatureId)) {
+			list.emplace_back(creature);
+			return false;
+		}
+
+		return true;
 	});
 
+	return list;
+}
+
+void Monster::updateTargetList() {
+	const auto isGone = [this](uint32_t creatureId) {
+		const auto &creature = g_game().getCreatureByID(creatureId);
+		return !creature || creature->getHealth() <= 0 || !canSee(creature->getPosition());
+	};
+	std::erase_if(friendList, isGone);
+	std::erase_if(targetList, isGone);
+
 	for (const auto &spectator : Spectators().find<Creature>(position, true)) {
 		if (spectator.get() != this && canSee(spectator->getPosition())) {
 			onCreatureFound(spectator);
@@ -594,9 +629,8 @@ bool Monster::searchTarget(TargetSearchType_t searchType /*= TARGETSEARCH_DEFAUL
 	std::vector<std::shared_ptr<Creature>> resultList;
 	const Position &myPos = getPosition();
 
-	for (const auto &cref : targetList) {
-		const auto &creature = cref.lock();
-		if (creature && isTarget(creature)) {
+	for (const auto &creature : getTargetList()) {
+		if (isTarget(creature)) {
 			if ((static_self_cast<Monster>()->targetDistance == 1) || canUseAttack(myPos, creature)) {
 				resultList.push_back(creature);
 			}
@@ -783,8 +817,7 @@ bool Monster::selectTarget(const std::shared_ptr<Creature> &creature) {
 		return false;
 	}
 
-	const auto &it = getTargetIterator(creature);
-	if (it == targetList.end()) {
+	if (!hasTarget(creature->getID())) {
 		// Target not found in our target list.
 		return false;
 	}
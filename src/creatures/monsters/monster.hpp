@@ -41,11 +41,7 @@ public:
 		return static_self_cast<Monster>();
 	}
 
-	void setID() override {
-		if (id == 0) {
-			id = monsterAutoID++;
-		}
-	}
+	void setID() override;
 
 	void addList() override;
 	void removeList() override;
@@ -196,37 +192,8 @@ public:
 	bool searchTarget(TargetSearchType_t searchType = TARGETSEARCH_DEFAULT);
 	bool selectTarget(const std::shared_ptr<Creature> &creature);
 
-	auto getTargetList() {
-		CreatureVector list;
-		list.reserve(targetList.size());
-
-		std::erase_if(targetList, [&list](const std::weak_ptr<Creature> &ref) {
-			if (const auto &creature = ref.lock()) {
-				list.emplace_back(creature);
-				return false;
-			}
-
-			return true;
-		});
-
-		return list;
-	}
-
-	auto getFriendList() {
-		CreatureVector list;
-		list.reserve(friendList.size());
-
-		std::erase_if(friendList, [&list](const auto &it) {
-			if (const auto &creature = it.second.lock()) {
-				list.emplace_back(creature);
-				return false;
-			}
-
-			return true;
-		});
-
-		return list;
-	}
+	CreatureVector getTargetList();
+	CreatureVector getFriendList();
 
 	bool isTarget(std::shared_ptr<Creature> creature);
 	bool isFleeing() const {
@@ -295,8 +262,6 @@ public:
 
 	BlockType_t blockHit(std::shared_ptr<Creature> attacker, CombatType_t combatType, int32_t &damage, bool checkDefense = false, bool checkArmor = false, bool field = false) override;
 
-	static uint32_t monsterAutoID;
-
 	void configureForgeSystem();
 
 	bool canBeForgeMonster() const {
@@ -373,15 +338,13 @@ public:
 	}
 
 private:
-	auto getTargetIterator(const std::shared_ptr<Creature> &creature) {
-		return std::ranges::find_if(targetList.begin(), targetList.end(), [id = creature->getID()](const std::weak_ptr<Creature> &ref) {
-			const auto &target = ref.lock();
-			return target && target->getID() == id;
-		});
+	bool hasTarget(uint32_t creatureId) const {
+		return std::ranges::find(targetList, creatureId) != targetList.end();
 	}
 
-	std::unordered_map<uint32_t, std::weak_ptr<Creature>> friendList;
-	std::deque<std::weak_ptr<Creature>> targetList;
+	// Creature ids: friends are kept sorted to be found by binary search, targets in the order they are picked
+	std::vector<uint32_t> friendList;
+	std::vector<uint32_t> targetList;
 
 	time_t timeToChangeFiendish = 0;
 
@@ -9,8 +9,9 @@
 
 #include "creatures/players/management/ban.hpp"
 #include "database/database.hpp"
-#include "database/databasetasks.hpp"
 #include "utils/tools.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lib/di/container.hpp"
 
 bool Ban::acceptConnection(uint32_t clientIP) {
 	std::scoped_lock<std::recursive_mutex> lockClass(lock);
@@ -45,67 +46,182 @@ bool Ban::acceptConnection(uint32_t clientIP) {
 	return true;
 }
 
-bool IOBan::isAccountBanned(uint32_t accountId, BanInfo &banInfo) {
-	Database &db = Database::getInstance();
+namespace {
+	struct CachedBan {
+		BanInfo info;
+		int64_t bannedAt = 0;
+		uint32_t bannedById = 0;
+	};
+
+	struct BanCache {
+		std::shared_mutex mutex;
+		phmap::flat_hash_map<uint32_t, CachedBan> accounts;
+		phmap::flat_hash_map<uint32_t, CachedBan> ips;
+		phmap::flat_hash_set<uint32_t> namelocks;
+		// Bumped by every single ban change, a reload that started before one is stale
+		uint64_t generation = 0;
+		// Only one reload queries the tables at a time
+		std::mutex reloadMutex;
+	};
+
+	BanCache &getBanCache() {
+		static BanCache banCache;
+		return banCache;
+	}
 
-	std::ostringstream query;
-	query << "SELECT `reason`, `expires_at`, `banned_at`, `banned_by`, (SELECT `name` FROM `players` WHERE `id` = `banned_by`) AS `name` FROM `account_bans` WHERE `account_id` = " << accountId;
+	bool isExpired(const BanInfo &banInfo, time_t now) {
+		return banInfo.expiresAt != 0 && now > banInfo.expiresAt;
+	}
 
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
-		return false;
+	bool getCachedBan(const phmap::flat_hash_map<uint32_t, CachedBan> &bans, uint32_t id, BanInfo &banInfo) {
+		auto it = bans.find(id);
+		// Expired bans are cleaned up by the next reload, not from the login path
+		if (it == bans.end() || isExpired(it->second.info, time(nullptr))) {
+			return false;
+		}
+
+		banInfo = it->second.info;
+		return true;
+	}
+
+	phmap::flat_hash_map<uint32_t, CachedBan> loadBanTable(Database &db, const std::string &table, const std::string &idColumn) {
+		phmap::flat_hash_map<uint32_t, CachedBan> bans;
+		const auto query = fmt::format("SELECT `b`.`{}`, `b`.`reason`, `b`.`expires_at`, `b`.`banned_at`, `b`.`banned_by`, `p`.`name` FROM `{}` AS `b` LEFT JOIN `players` AS `p` ON `p`.`id` = `b`.`banned_by`", idColumn, table);
+		if (DBResult_ptr result = db.storeQuery(query)) {
+			do {
+				CachedBan ban { { result->getString("name"), result->getString("reason"), result->getNumber<time_t>("expires_at") }, result->getNumber<int64_t>("banned_at"), result->getNumber<uint32_t>("banned_by") };
+				bans.emplace(result->getNumber<uint32_t>(idColumn), std::move(ban));
+			} while (result->next());
+		}
+		return bans;
 	}
+}
 
-	int64_t expiresAt = result->getNumber<int64_t>("expires_at");
-	if (expiresAt != 0 && time(nullptr) > expiresAt) {
-		// Move the ban to history if it has expired
-		query.str(std::string());
-		query << "INSERT INTO `account_ban_history` (`account_id`, `reason`, `banned_at`, `expired_at`, `banned_by`) VALUES (" << accountId << ',' << db.escapeString(result->getString("reason")) << ',' << result->getNumber<time_t>("banned_at") << ',' << expiresAt << ',' << result->getNumber<uint32_t>("banned_by") << ')';
-		g_databaseTasks().execute(query.str());
+void IOBan::loadBans() {
+	auto &banCache = getBanCache();
+	std::scoped_lock reloadLock(banCache.reloadMutex);
 
-		query.str(std::string());
-		query << "DELETE FROM `account_bans` WHERE `account_id` = " << accountId;
-		g_databaseTasks().execute(query.str());
+	uint64_t generation;
+	{
+		std::shared_lock lock(banCache.mutex);
+		generation = banCache.generation;
+	}
+
+	Database &db = Database::getInstance();
+	const time_t now = time(nullptr);
+
+	// Move expired account bans to the history and drop expired ip bans before reading the tables
+	const auto expired = fmt::format("`expires_at` != 0 AND `expires_at` < {}", now);
+	db.executeQuery(fmt::format("INSERT INTO `account_ban_history` (`account_id`, `reason`, `banned_at`, `expired_at`, `banned_by`) SELECT `account_id`, `reason`, `banned_at`, `expires_at`, `banned_by` FROM `account_bans` WHERE {}", expired));
+	db.executeQuery(fmt::format("DELETE FROM `account_bans` WHERE {}", expired));
+	db.executeQuery(fmt::format("DELETE FROM `ip_bans` WHERE {}", expired));
+
+	auto accounts = loadBanTable(db, "account_bans", "account_id");
+	auto ips = loadBanTable(db, "ip_bans", "ip");
+
+	phmap::flat_hash_set<uint32_t> namelocks;
+	if (DBResult_ptr result = db.storeQuery("SELECT `player_id` FROM `player_namelocks`")) {
+		do {
+			namelocks.emplace(result->getNumber<uint32_t>("player_id"));
+		} while (result->next());
+	}
+
+	std::unique_lock lock(banCache.mutex);
+	if (banCache.generation != generation) {
+		// A ban was added or removed while querying, this snapshot may not have it; the next reload picks up the rest
+		g_logger().debug("[{}] - Discarding stale ban reload", __FUNCTION__);
+		return;
+	}
+
+	banCache.accounts = std::move(accounts);
+	banCache.ips = std::move(ips);
+	banCache.namelocks = std::move(namelocks);
+}
+
+void IOBan::reloadBansAsync() {
+	inject<ThreadPool>().detach_task([] { loadBans(); });
+}
+
+bool IOBan::addAccountBan(uint32_t accountId, const std::string &reason, time_t expiresAt, uint32_t bannedById, const std::string &bannedByName) {
+	Database &db = Database::getInstance();
+	const time_t now = time(nullptr);
+
+	std::ostringstream query;
+	query << "INSERT INTO `account_bans` (`account_id`, `reason`, `banned_at`, `expires_at`, `banned_by`) VALUES (" << accountId << ',' << db.escapeString(reason) << ',' << now << ',' << expiresAt << ',' << bannedById << ')';
+	if (!db.executeQuery(query.str())) {
 		return false;
 	}
 
-	banInfo.expiresAt = expiresAt;
-	banInfo.reason = result->getString("reason");
-	banInfo.bannedBy = result->getString("name");
+	auto &banCache = getBanCache();
+	std::unique_lock lock(banCache.mutex);
+	++banCache.generation;
+	banCache.accounts.insert_or_assign(accountId, CachedBan { { bannedByName, reason, expiresAt }, now, bannedById });
 	return true;
 }
 
-bool IOBan::isIpBanned(uint32_t clientIP, BanInfo &banInfo) {
-	if (clientIP == 0) {
+bool IOBan::removeAccountBan(uint32_t accountId) {
+	std::ostringstream query;
+	query << "DELETE FROM `account_bans` WHERE `account_id` = " << accountId;
+	if (!Database::getInstance().executeQuery(query.str())) {
 		return false;
 	}
 
+	auto &banCache = getBanCache();
+	std::unique_lock lock(banCache.mutex);
+	++banCache.generation;
+	banCache.accounts.erase(accountId);
+	return true;
+}
+
+bool IOBan::addIpBan(uint32_t ip, const std::string &reason, time_t expiresAt, uint32_t bannedById, const std::string &bannedByName) {
 	Database &db = Database::getInstance();
+	const time_t now = time(nullptr);
 
 	std::ostringstream query;
-	query << "SELECT `reason`, `expires_at`, (SELECT `name` FROM `players` WHERE `id` = `banned_by`) AS `name` FROM `ip_bans` WHERE `ip` = " << clientIP;
-
-	DBResult_ptr result = db.storeQuery(query.str());
-	if (!result) {
+	query << "INSERT INTO `ip_bans` (`ip`, `reason`, `banned_at`, `expires_at`, `banned_by`) VALUES (" << ip << ',' << db.escapeString(reason) << ',' << now << ',' << expiresAt << ',' << bannedById << ')';
+	if (!db.executeQuery(query.str())) {
 		return false;
 	}
 
-	int64_t expiresAt = result->getNumber<int64_t>("expires_at");
-	if (expiresAt != 0 && time(nullptr) > expiresAt) {
-		query.str(std::string());
-		query << "DELETE FROM `ip_bans` WHERE `ip` = " << clientIP;
-		g_databaseTasks().execute(query.str());
+	auto &banCache = getBanCache();
+	std::unique_lock lock(banCache.mutex);
+	++banCache.generation;
+	banCache.ips.insert_or_assign(ip, CachedBan { { bannedByName, reason, expiresAt }, now, bannedById });
+	return true;
+}
+
+bool IOBan::removeIpBan(uint32_t ip) {
+	std::ostringstream query;
+	query << "DELETE FROM `ip_bans` WHERE `ip` = " << ip;
+	if (!Database::getInstance().executeQuery(query.str())) {
 		return false;
 	}
 
-	banInfo.expiresAt = expiresAt;
-	banInfo.reason = result->getString("reason");
-	banInfo.bannedBy = result->getString("name");
+	auto &banCache = getBanCache();
+	std::unique_lock lock(banCache.mutex);
+	++banCache.generation;
+	banCache.ips.erase(ip);
 	return true;
 }
 
+bool IOBan::isAccountBanned(uint32_t accountId, BanInfo &banInfo) {
+	auto &banCache = getBanCache();
+	std::shared_lock lock(banCache.mutex);
+	return getCachedBan(banCache.accounts, accountId, banInfo);
+}
+
+bool IOBan::isIpBanned(uint32_t clientIP, BanInfo &banInfo) {
+	if (clientIP == 0) {
+		return false;
+	}
+
+	auto &banCache = getBanCache();
+	std::shared_lock lock(banCache.mutex);
+	return getCachedBan(banCache.ips, clientIP, banInfo);
+}
+
 bool IOBan::isPlayerNamelocked(uint32_t playerId) {
-	std::ostringstream query;
-	query << "SELECT 1 FROM `player_namelocks` WHERE `player_id` = " << playerId;
-	return Database::getInstance().storeQuery(query.str()).get() != nullptr;
+	auto &banCache = getBanCache();
+	std::shared_lock lock(banCache.mutex);
+	return banCache.namelocks.contains(playerId);
 }
@@ -37,6 +37,31 @@ private:
 
 class IOBan {
 public:
+	/**
+	 * @brief Reloads every account ban, ip ban and namelock from the database into memory.
+	 *
+	 * Expired account bans are moved to the history and expired ip bans are deleted first.
+	 * Called at startup and periodically to pick up changes made outside the server. Reloads
+	 * run one at a time, and a reload that overlaps a ban added or removed by the server is discarded.
+	 */
+	static void loadBans();
+	/**
+	 * @brief Same as loadBans(), on the thread pool.
+	 */
+	static void reloadBansAsync();
+
+	/**
+	 * @brief Writes a ban to the database and adds it to the cache, replacing any ban on the same account.
+	 * @return false if the database write failed, the cache is left untouched then.
+	 */
+	static bool addAccountBan(uint32_t accountId, const std::string &reason, time_t expiresAt, uint32_t bannedById, const std::string &bannedByName);
+	static bool removeAccountBan(uint32_t accountId);
+	/**
+	 * @brief Same as addAccountBan(), for an ip.
+	 */
+	static bool addIpBan(uint32_t ip, const std::string &reason, time_t expiresAt, uint32_t bannedById, const std::string &bannedByName);
+	static bool removeIpBan(uint32_t ip);
+
 	static bool isAccountBanned(uint32_t accountId, BanInfo &banInfo);
 	static bool isIpBanned(uint32_t clientIP, BanInfo &banInfo);
 	static bool isPlayerNamelocked(uint32_t playerId);
@@ -726,7 +726,9 @@ void Player::addSkillAdvance(skills_t skill, uint64_t count) {
 	}
 
 	g_events().eventPlayerOnGainSkillTries(static_self_cast<Player>(), skill, count);
-	g_callbacks().executeCallback(EventCallback_t::playerOnGainSkillTries, &EventCallback::playerOnGainSkillTries, getPlayer(), std::ref(skill), std::ref(count));
+	if (g_callbacks().hasCallbacks(EventCallback_t::playerOnGainSkillTries)) {
+		g_callbacks().executeCallback(EventCallback_t::playerOnGainSkillTries, &EventCallback::playerOnGainSkillTries, getPlayer(), std::ref(skill), std::ref(count));
+	}
 	if (count == 0) {
 		return;
 	}
@@ -1986,7 +1988,9 @@ void Player::onWalk(Direction &dir) {
 	Creature::onWalk(dir);
 	setNextActionTask(nullptr);
 
-	g_callbacks().executeCallback(EventCallback_t::playerOnWalk, &EventCallback::playerOnWalk, getPlayer(), dir);
+	if (g_callbacks().hasCallbacks(EventCallback_t::playerOnWalk)) {
+		g_callbacks().executeCallback(EventCallback_t::playerOnWalk, &EventCallback::playerOnWalk, getPlayer(), dir);
+	}
 }
 
 void Player::onCreatureMove(const std::shared_ptr<Creature> &creature, const std::shared_ptr<Tile> &newTile, const Position &newPos, const std::shared_ptr<Tile> &oldTile, const Position &oldPos, bool teleport) {
@@ -2286,7 +2290,10 @@ void Player::onThink(uint32_t interval) {
 	// Wheel of destiny major spells
 	wheel()->onThink();
 
-	g_callbacks().executeCallback(EventCallback_t::playerOnThink, &EventCallback::playerOnThink, getPlayer(), interval);
+	// Runs every think for every player, skip building the arguments when nothing listens
+	if (g_callbacks().hasCallbacks(EventCallback_t::playerOnThink)) {
+		g_callbacks().executeCallback(EventCallback_t::playerOnThink, &EventCallback::playerOnThink, getPlayer(), interval);
+	}
 }
 
 uint32_t Player::isMuted() const {
@@ -2295,6 +2302,7 @@ uint32_t Player::isMuted() const {
 	}
 
 	int32_t muteTicks = 0;
+	syncConditions();
 	for (const std::shared_ptr<Condition> &condition : conditions) {
 		if (condition->getType() == CONDITION_MUTED && condition->getTicks() > muteTicks) {
 			muteTicks = condition->getTicks();
@@ -2941,33 +2949,33 @@ void Player::death(std::shared_ptr<Creature> lastHitCreature) {
 			mana = manaMax;
 		}
 
-		auto it = conditions.begin(), end = conditions.end();
-		while (it != end) {
-			std::shared_ptr<Condition> condition = *it;
+		size_t index = 0;
+		while (index < conditions.size()) {
+			std::shared_ptr<Condition> condition = conditions[index];
 			// isSupress block to delete spells conditions (ensures that the player cannot, for example, reset the cooldown time of the familiar and summon several)
 			if (condition->isPersistent() && condition->isRemovableOnDeath()) {
-				it = conditions.erase(it);
+				conditions.erase(conditions.begin() + index);
 
 				condition->endCondition(static_self_cast<Player>());
 				onEndCondition(condition->getType());
 			} else {
-				++it;
+				++index;
 			}
 		}
 		despawn();
 	} else {
 		setSkillLoss(true);
 
-		auto it = conditions.begin(), end = conditions.end();
-		while (it != end) {
-			std::shared_ptr<Condition> condition = *it;
+		size_t index = 0;
+		while (index < conditions.size()) {
+			std::shared_ptr<Condition> condition = conditions[index];
 			if (condition->isPersistent()) {
-				it = conditions.erase(it);
+				conditions.erase(conditions.begin() + index);
 
 				condition->endCondition(static_self_cast<Player>());
 				onEndCondition(condition->getType());
 			} else {
-				++it;
+				++index;
 			}
 		}
 
@@ -6052,7 +6060,9 @@ bool Player::addOfflineTrainingTries(skills_t skill, uint64_t tries) {
 		oldPercentToNextLevel = static_cast<long double>(manaSpent * 100) / nextReqMana;
 
 		g_events().eventPlayerOnGainSkillTries(static_self_cast<Player>(), SKILL_MAGLEVEL, tries);
-		g_callbacks().executeCallback(EventCallback_t::playerOnGainSkillTries, &EventCallback::playerOnGainSkillTries, getPlayer(), SKILL_MAGLEVEL, std::ref(tries));
+		if (g_callbacks().hasCallbacks(EventCallback_t::playerOnGainSkillTries)) {
+			g_callbacks().executeCallback(EventCallback_t::playerOnGainSkillTries, &EventCallback::playerOnGainSkillTries, getPlayer(), SKILL_MAGLEVEL, std::ref(tries));
+		}
 
 		uint32_t currMagLevel = magLevel;
 		while ((manaSpent + tries) >= nextReqMana) {
@@ -6108,7 +6118,9 @@ bool Player::addOfflineTrainingTries(skills_t skill, uint64_t tries) {
 		oldPercentToNextLevel = static_cast<long double>(skills[skill].tries * 100) / nextReqTries;
 
 		g_events().eventPlayerOnGainSkillTries(static_self_cast<Player>(), skill, tries);
-		g_callbacks().executeCallback(EventCallback_t::playerOnGainSkillTries, &EventCallback::playerOnGainSkillTries, getPlayer(), skill, tries);
+		if (g_callbacks().hasCallbacks(EventCallback_t::playerOnGainSkillTries)) {
+			g_callbacks().executeCallback(EventCallback_t::playerOnGainSkillTries, &EventCallback::playerOnGainSkillTries, getPlayer(), skill, tries);
+		}
 		uint32_t currSkillLevel = skills[skill].level;
 
 		while ((skills[skill].tries + tries) >= nextReqTries) {
@@ -6365,6 +6377,7 @@ size_t Player::getMaxDepotItems() const {
 std::vector<std::shared_ptr<Condition>> Player::getMuteConditions() const {
 	std::vector<std::shared_ptr<Condition>> muteConditions;
 	muteConditions.reserve(conditions.size());
+	syncConditions();
 
 	for (const std::shared_ptr<Condition> &condition : conditions) {
 		if (condition->getTicks() <= 0) {
@@ -6429,6 +6442,23 @@ void Player::updateUIExhausted() {
 	lastUIInteraction = OTSYS_TIME();
 }
 
+charmRune_t Player::getCharmRuneByRace(uint16_t raceId) {
+	if (charmRuneByRaceOutdated) {
+		charmRuneByRace.clear();
+		// Highest rune first, the first one found wins if two share a race
+		for (int8_t bit = 31; bit >= 0; --bit) {
+			if ((UsedRunesBit & (1 << bit)) != 0) {
+				const auto charmId = static_cast<charmRune_t>(bit);
+				charmRuneByRace.try_emplace(parseRacebyCharm(charmId, false, 0), charmId);
+			}
+		}
+		charmRuneByRaceOutdated = false;
+	}
+
+	auto it = charmRuneByRace.find(raceId);
+	return it != charmRuneByRace.end() ? it->second : CHARM_NONE;
+}
+
 void Player::setImmuneFear() {
 	m_fearCondition.first = CONDITION_FEARED;
 	m_fearCondition.second = OTSYS_TIME() + 10000;
@@ -6768,6 +6798,7 @@ void Player::triggerMomentum() {
 	double_t randomChance = uniform_random(0, 10000) / 100.;
 	if (getZoneType() != ZONE_PROTECTION && hasCondition(CONDITION_INFIGHT) && ((OTSYS_TIME() / 1000) % 2) == 0 && chance > 0 && randomChance < chance) {
 		bool triggered = false;
+		syncConditions();
 		auto it = conditions.begin();
 		while (it != conditions.end()) {
 			auto condItem = *it;
@@ -6792,6 +6823,7 @@ void Player::triggerMomentum() {
 }
 
 void Player::clearCooldowns() {
+	syncConditions();
 	auto it = conditions.begin();
 	while (it != conditions.end()) {
 		auto condItem = *it;
@@ -7186,7 +7218,9 @@ bool Player::saySpell(
 		tmpPlayer->onCreatureSay(static_self_cast<Player>(), type, text);
 		if (static_self_cast<Player>() != tmpPlayer) {
 			g_events().eventCreatureOnHear(tmpPlayer, getPlayer(), text, type);
-			g_callbacks().executeCallback(EventCallback_t::creatureOnHear, &EventCallback::creatureOnHear, tmpPlayer, getPlayer(), text, type);
+			if (g_callbacks().hasCallbacks(EventCallback_t::creatureOnHear)) {
+				g_callbacks().executeCallback(EventCallback_t::creatureOnHear, &EventCallback::creatureOnHear, tmpPlayer, getPlayer(), text, type);
+			}
 		}
 	}
 	return true;
@@ -1161,6 +1161,11 @@ public:
 			client->sendCreatureSay(creature, type, text, pos);
 		}
 	}
+	void sendCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses type, const std::string &text, const Position* pos, SharedNetworkMessage &message) {
+		if (client) {
+			client->sendCreatureSay(creature, type, text, pos, message);
+		}
+	}
 	void sendCreatureReload(std::shared_ptr<Creature> creature) {
 		if (client) {
 			client->reloadCreature(creature);
@@ -1379,11 +1384,21 @@ public:
 			client->sendChangeSpeed(creature, newSpeed);
 		}
 	}
+	void sendChangeSpeed(std::shared_ptr<Creature> creature, uint16_t newSpeed, SharedNetworkMessage &message) const {
+		if (client) {
+			client->sendChangeSpeed(creature, newSpeed, message);
+		}
+	}
 	void sendCreatureHealth(std::shared_ptr<Creature> creature) const {
 		if (client) {
 			client->sendCreatureHealth(creature);
 		}
 	}
+	void sendCreatureHealth(std::shared_ptr<Creature> creature, SharedNetworkMessage &message) const {
+		if (client) {
+			client->sendCreatureHealth(creature, message);
+		}
+	}
 	void sendPartyCreatureUpdate(std::shared_ptr<Creature> creature) const {
 		if (client) {
 			client->sendPartyCreatureUpdate(creature);
@@ -1429,6 +1444,11 @@ public:
 			client->sendDistanceShoot(from, to, type);
 		}
 	}
+	void sendDistanceShoot(const Position &from, const Position &to, uint16_t type, SharedNetworkMessage &message) const {
+		if (client) {
+			client->sendDistanceShoot(from, to, type, message);
+		}
+	}
 	void sendHouseWindow(std::shared_ptr<House> house, uint32_t listId) const;
 	void sendCreatePrivateChannel(uint16_t channelId, const std::string &channelName) {
 		if (client) {
@@ -1455,6 +1475,11 @@ public:
 			client->sendMagicEffect(pos, type);
 		}
 	}
+	void sendMagicEffect(const Position &pos, uint16_t type, SharedNetworkMessage &message) const {
+		if (client) {
+			client->sendMagicEffect(pos, type, message);
+		}
+	}
 	void removeMagicEffect(const Position &pos, uint16_t type) const {
 		if (client) {
 			client->removeMagicEffect(pos, type);
@@ -1964,6 +1989,7 @@ public:
 	}
 	void setUsedRunesBit(int32_t bit) {
 		UsedRunesBit = bit;
+		charmRuneByRaceOutdated = true;
 	}
 	int32_t getUsedRunesBit() {
 		return UsedRunesBit;
@@ -1988,7 +2014,19 @@ public:
 	}
 	void setImmuneFear();
 	bool isImmuneFear() const;
+
+	/**
+	 * @brief Returns the charm rune in use on a bestiary race, or CHARM_NONE.
+	 *
+	 * Called on every hit, so it is a single lookup in a table that is only
+	 * rebuilt after the used runes or their races change.
+	 */
+	charmRune_t getCharmRuneByRace(uint16_t raceId);
 	uint16_t parseRacebyCharm(charmRune_t charmId, bool set, uint16_t newRaceid) {
+		if (set) {
+			charmRuneByRaceOutdated = true;
+		}
+
 		uint16_t raceid = 0;
 		switch (charmId) {
 			case CHARM_WOUND:
@@ -2925,6 +2963,8 @@ private:
 	uint32_t charmPoints = 0;
 	int32_t UsedRunesBit = 0;
 	int32_t UnlockedRunesBit = 0;
+	phmap::flat_hash_map<uint16_t, charmRune_t> charmRuneByRace;
+	bool charmRuneByRaceOutdated = true;
 	std::pair<ConditionType_t, uint64_t> cleanseCondition = { CONDITION_NONE, 0 };
 
 	std::pair<ConditionType_t, uint64_t> m_fearCondition = { CONDITION_NONE, 0 };
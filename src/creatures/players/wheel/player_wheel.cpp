@@ -78,53 +78,13 @@ const static std::vector<WheelGemBasicModifier_t> wheelGemBasicSlot2Allowed = {
 // Here are built-in helper functions
 namespace {
 	template <typename SpellType>
-	bool checkSpellArea(const std::array<SpellType, 5> &spellsTable, const std::string &spellName, uint8_t stage) {
+	const WheelSpells::Bonus* findSpellGrade(const std::array<SpellType, 5> &spellsTable, const std::string &spellName, uint8_t stage) {
 		for (const auto &spellTable : spellsTable) {
-			auto size = std::ssize(spellTable.grade);
-			g_logger().debug("spell area stage {}, grade {}", stage, size);
-			if (spellTable.name == spellName && stage < static_cast<uint8_t>(size)) {
-				const auto &spellData = spellTable.grade[stage];
-				if (spellData.increase.area) {
-					g_logger().debug("[{}] spell with name {}, and stage {} has increase area", __FUNCTION__, spellName, stage);
-
-					return true;
-				}
+			if (spellTable.name == spellName && stage < spellTable.grade.size()) {
+				return &spellTable.grade[stage];
 			}
 		}
-
-		return false;
-	}
-
-	template <typename SpellType>
-	int checkSpellAdditionalTarget(const std::array<SpellType, 5> &spellsTable, const std::string_view &spellName, uint8_t stage) {
-		for (const auto &spellTable : spellsTable) {
-			auto size = std::ssize(spellTable.grade);
-			g_logger().debug("spell target stage {}, grade {}", stage, size);
-			if (spellTable.name == spellName && stage < static_cast<uint8_t>(size)) {
-				const auto &spellData = spellTable.grade[stage];
-				if (spellData.increase.aditionalTarget) {
-					return spellData.increase.aditionalTarget;
-				}
-			}
-		}
-
-		return 0;
-	}
-
-	template <typename SpellType>
-	int checkSpellAdditionalDuration(const std::array<SpellType, 5> &spellsTable, const std::string_view &spellName, uint8_t stage) {
-		for (const auto &spellTable : spellsTable) {
-			auto size = std::ssize(spellTable.grade);
-			g_logger().debug("spell duration stage {}, grade {}", stage, size);
-			if (spellTable.name == spellName && stage < static_cast<uint8_t>(size)) {
-				const auto &spellData = spellTable.grade[stage];
-				if (spellData.increase.duration > 0) {
-					return spellData.increase.duration;
-				}
-			}
-		}
-
-		return 0;
+		return nullptr;
 	}
 
 	struct PromotionScroll {
@@ -681,63 +641,80 @@ uint16_t PlayerWheel::getUnusedPoints() const {
 }
 
 bool PlayerWheel::getSpellAdditionalArea(const std::string &spellName) const {
-	auto stage = static_cast<uint8_t>(getSpellUpgrade(spellName));
-	if (stage == 0) {
-		return false;
-	}
+	const auto spell = getResolvedSpell(spellName);
+	return spell && spell->additionalArea;
+}
 
-	auto vocationEnum = m_player.getPlayerVocationEnum();
-	if (vocationEnum == Vocation_t::VOCATION_KNIGHT_CIP) {
-		return checkSpellArea(g_game().getIOWheel()->getWheelBonusData().spells.knight, spellName, stage);
-	} else if (vocationEnum == Vocation_t::VOCATION_PALADIN_CIP) {
-		return checkSpellArea(g_game().getIOWheel()->getWheelBonusData().spells.paladin, spellName, stage);
-	} else if (vocationEnum == Vocation_t::VOCATION_DRUID_CIP) {
-		return checkSpellArea(g_game().getIOWheel()->getWheelBonusData().spells.druid, spellName, stage);
-	} else if (vocationEnum == Vocation_t::VOCATION_SORCERER_CIP) {
-		return checkSpellArea(g_game().getIOWheel()->getWheelBonusData().spells.sorcerer, spellName, stage);
-	}
+int PlayerWheel::getSpellAdditionalTarget(const std::string &spellName) const {
+	const auto spell = getResolvedSpell(spellName);
+	return spell ? spell->additionalTarget : 0;
+}
 
-	return false;
+int PlayerWheel::getSpellAdditionalDuration(const std::string &spellName) const {
+	const auto spell = getResolvedSpell(spellName);
+	return spell ? spell->additionalDuration : 0;
 }
 
-int PlayerWheel::getSpellAdditionalTarget(const std::string &spellName) const {
-	auto stage = static_cast<uint8_t>(getSpellUpgrade(spellName));
-	if (stage == 0) {
-		return 0;
+const PlayerWheel::ResolvedSpell* PlayerWheel::getResolvedSpell(const std::string &spellName) const {
+	auto it = m_resolvedSpells.find(spellName);
+	return it != m_resolvedSpells.end() ? &it->second : nullptr;
+}
+
+void PlayerWheel::resolveSpell(const std::string &spellName) {
+	auto selectedIt = m_spellsSelected.find(spellName);
+	auto bonusIt = m_spellsBonuses.find(spellName);
+	if (selectedIt == m_spellsSelected.end() && bonusIt == m_spellsBonuses.end()) {
+		m_resolvedSpells.erase(spellName);
+		return;
 	}
 
-	auto vocationEnum = m_player.getPlayerVocationEnum();
-	if (vocationEnum == Vocation_t::VOCATION_KNIGHT_CIP) {
-		return checkSpellAdditionalTarget(g_game().getIOWheel()->getWheelBonusData().spells.knight, spellName, stage);
-	} else if (vocationEnum == Vocation_t::VOCATION_PALADIN_CIP) {
-		return checkSpellAdditionalTarget(g_game().getIOWheel()->getWheelBonusData().spells.paladin, spellName, stage);
-	} else if (vocationEnum == Vocation_t::VOCATION_DRUID_CIP) {
-		return checkSpellAdditionalTarget(g_game().getIOWheel()->getWheelBonusData().spells.druid, spellName, stage);
-	} else if (vocationEnum == Vocation_t::VOCATION_SORCERER_CIP) {
-		return checkSpellAdditionalTarget(g_game().getIOWheel()->getWheelBonusData().spells.sorcerer, spellName, stage);
+	ResolvedSpell spell;
+	if (selectedIt != m_spellsSelected.end()) {
+		spell.grade = selectedIt->second;
+		resolveSpellGrade(spellName, spell);
+	}
+	if (bonusIt != m_spellsBonuses.end()) {
+		spell.bonus = bonusIt->second;
 	}
+	m_resolvedSpells.insert_or_assign(spellName, spell);
+}
 
-	return 0;
+void PlayerWheel::resolveSpells() {
+	m_resolvedSpells.clear();
+	for (const auto &[spellName, grade] : m_spellsSelected) {
+		resolveSpell(spellName);
+	}
+	for (const auto &[spellName, bonus] : m_spellsBonuses) {
+		if (!m_resolvedSpells.contains(spellName)) {
+			resolveSpell(spellName);
+		}
+	}
 }
 
-int PlayerWheel::getSpellAdditionalDuration(const std::string &spellName) const {
-	auto stage = static_cast<uint8_t>(getSpellUpgrade(spellName));
+void PlayerWheel::resolveSpellGrade(const std::string &spellName, ResolvedSpell &spell) const {
+	auto stage = static_cast<uint8_t>(spell.grade);
 	if (stage == 0) {
-		return 0;
+		return;
 	}
 
+	const auto &spellsData = g_game().getIOWheel()->getWheelBonusData().spells;
+	const WheelSpells::Bonus* gradeData = nullptr;
 	auto vocationEnum = m_player.getPlayerVocationEnum();
 	if (vocationEnum == Vocation_t::VOCATION_KNIGHT_CIP) {
-		return checkSpellAdditionalDuration(g_game().getIOWheel()->getWheelBonusData().spells.knight, spellName, stage);
+		gradeData = findSpellGrade(spellsData.knight, spellName, stage);
 	} else if (vocationEnum == Vocation_t::VOCATION_PALADIN_CIP) {
-		return checkSpellAdditionalDuration(g_game().getIOWheel()->getWheelBonusData().spells.paladin, spellName, stage);
+		gradeData = findSpellGrade(spellsData.paladin, spellName, stage);
 	} else if (vocationEnum == Vocation_t::VOCATION_DRUID_CIP) {
-		return checkSpellAdditionalDuration(g_game().getIOWheel()->getWheelBonusData().spells.druid, spellName, stage);
+		gradeData = findSpellGrade(spellsData.druid, spellName, stage);
 	} else if (vocationEnum == Vocation_t::VOCATION_SORCERER_CIP) {
-		return checkSpellAdditionalDuration(g_game().getIOWheel()->getWheelBonusData().spells.sorcerer, spellName, stage);
+		gradeData = findSpellGrade(spellsData.sorcerer, spellName, stage);
 	}
 
-	return 0;
+	if (gradeData) {
+		spell.additionalArea = gradeData->increase.area;
+		spell.additionalTarget = gradeData->increase.aditionalTarget;
+		spell.additionalDuration = std::max(0, gradeData->increase.duration);
+	}
 }
 
 void PlayerWheel::addPromotionScrolls(NetworkMessage &msg) const {
@@ -767,25 +744,8 @@ std::shared_ptr<KV> PlayerWheel::gemsKV() const {
 
 std::vector<PlayerWheelGem> PlayerWheel::getRevealedGems() const {
 	std::vector<PlayerWheelGem> unlockedGems;
-	auto unlockedGemUUIDs = gemsKV()->scoped("revealed")->keys();
-	if (unlockedGemUUIDs.empty()) {
-		return unlockedGems;
-	}
-
-	std::vector<std::string> sortedUnlockedGemGUIDs;
-	for (const auto &uuid : unlockedGemUUIDs) {
-		sortedUnlockedGemGUIDs.push_back(uuid);
-	}
-
-	std::sort(sortedUnlockedGemGUIDs.begin(), sortedUnlockedGemGUIDs.end(), [](const std::string &a, const std::string &b) {
-		if (std::ranges::all_of(a, ::isdigit) && std::ranges::all_of(b, ::isdigit)) {
-			return std::stoull(a) < std::stoull(b);
-		} else {
-			return a < b;
-		}
-	});
-
-	for (const auto &uuid : sortedUnlockedGemGUIDs) {
+	// KV::generateUUID is fixed width, so the lexicographic order of the keys is the reveal order
+	for (const auto &uuid : gemsKV()->scoped("revealed")->keys()) {
 		auto gem = PlayerWheelGem::load(gemsKV(), uuid);
 		if (gem.uuid.empty()) {
 			continue;
@@ -1400,6 +1360,7 @@ void PlayerWheel::registerPlayerBonusData() {
 	}
 	m_modifierContext->resetStrategies();
 	m_spellsBonuses.clear();
+	resolveSpells();
 
 	addStat(WheelStat_t::HEALTH, m_playerBonusData.stats.health);
 	addStat(WheelStat_t::MANA, m_playerBonusData.stats.mana);
@@ -2541,6 +2502,7 @@ void PlayerWheel::resetUpgradedSpells() {
 	m_creaturesNearby = 0;
 	m_spellsSelected.clear();
 	m_learnedSpellsSelected.clear();
+	resolveSpells();
 	for (int i = 0; i < static_cast<int>(WheelMajor_t::TOTAL_COUNT); i++) {
 		setMajorStat(static_cast<WheelMajor_t>(i), 0);
 	}
@@ -2562,6 +2524,7 @@ void PlayerWheel::upgradeSpell(const std::string &name) {
 	} else if (m_spellsSelected[name] == WheelSpellGrade_t::UPGRADED) {
 		m_spellsSelected[name] = WheelSpellGrade_t::MAX;
 	}
+	resolveSpell(name);
 }
 
 void PlayerWheel::downgradeSpell(const std::string &name) {
@@ -2572,6 +2535,7 @@ void PlayerWheel::downgradeSpell(const std::string &name) {
 	} else if (m_spellsSelected[name] == WheelSpellGrade_t::MAX) {
 		m_spellsSelected[name] = WheelSpellGrade_t::UPGRADED;
 	}
+	resolveSpell(name);
 }
 
 std::shared_ptr<Spell> PlayerWheel::getCombatDataSpell(CombatDamage &damage) {
@@ -2885,12 +2849,8 @@ int32_t PlayerWheel::getResistance(CombatType_t type) const {
 }
 
 WheelSpellGrade_t PlayerWheel::getSpellUpgrade(const std::string &name) const {
-	for (const auto &[name_it, grade_it] : m_spellsSelected) {
-		if (name_it == name) {
-			return grade_it;
-		}
-	}
-	return WheelSpellGrade_t::NONE;
+	const auto spell = getResolvedSpell(name);
+	return spell ? spell->grade : WheelSpellGrade_t::NONE;
 }
 
 double PlayerWheel::getMitigationMultiplier() const {
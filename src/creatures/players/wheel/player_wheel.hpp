@@ -384,16 +384,18 @@ public:
 			m_spellsBonuses[spellName].increase.heal += bonus.increase.heal;
 			m_spellsBonuses[spellName].leech.life += bonus.leech.life;
 			m_spellsBonuses[spellName].leech.mana += bonus.leech.mana;
-			return;
+		} else {
+			m_spellsBonuses[spellName] = bonus;
 		}
-		m_spellsBonuses[spellName] = bonus;
+		resolveSpell(spellName);
 	}
 
 	int32_t getSpellBonus(const std::string &spellName, WheelSpellBoost_t boost) const {
-		if (!m_spellsBonuses.contains(spellName)) {
+		const auto resolved = getResolvedSpell(spellName);
+		if (!resolved) {
 			return 0;
 		}
-		auto bonus = m_spellsBonuses.at(spellName);
+		const auto &bonus = resolved->bonus;
 		switch (boost) {
 			case WheelSpellBoost_t::COOLDOWN:
 				return bonus.decrease.cooldown;
@@ -424,6 +426,27 @@ public:
 
 private:
 	friend class Player;
+
+	/**
+	 * @brief Wheel data of a spell, resolved whenever its grade or bonuses change.
+	 *
+	 * Spells query it when they are cast, so that is a single lookup instead of
+	 * searching the vocation spells table.
+	 */
+	struct ResolvedSpell {
+		WheelSpellGrade_t grade = WheelSpellGrade_t::NONE;
+		bool additionalArea = false;
+		int additionalTarget = 0;
+		int additionalDuration = 0;
+		WheelSpells::Bonus bonus;
+	};
+
+	const ResolvedSpell* getResolvedSpell(const std::string &spellName) const;
+	void resolveSpell(const std::string &spellName);
+	void resolveSpells();
+	// Grade data of the spell for the player vocation, from the wheel spells table
+	void resolveSpellGrade(const std::string &spellName, ResolvedSpell &spell) const;
+
 	// Reference to the player
 	Player &m_player;
 
@@ -445,4 +468,5 @@ private:
 	std::map<std::string, WheelSpellGrade_t> m_spellsSelected;
 	std::vector<std::string> m_learnedSpellsSelected;
 	std::unordered_map<std::string, WheelSpells::Bonus> m_spellsBonuses;
+	phmap::flat_hash_map<std::string, ResolvedSpell> m_resolvedSpells;
 };
@@ -17,6 +17,7 @@
 #include "lua/callbacks/event_callback.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
 #include "creatures/players/highscore_category.hpp"
+#include "creatures/players/management/ban.hpp"
 #include "game/zones/zone.hpp"
 #include "lua/global/globalevent.hpp"
 #include "io/iologindata.hpp"
@@ -395,7 +396,7 @@ Game::Game() {
 Game::~Game() = default;
 
 void Game::resetMonsters() const {
-	for (const auto &[monsterId, monster] : getMonsters()) {
+	for (const auto &monster : getMonsters()) {
 		monster->clearTargetList();
 		monster->clearFriendList();
 	}
@@ -518,6 +519,10 @@ void Game::start(ServiceManager* manager) {
 	g_dispatcher().cycleEvent(
 		EVENT_LUA_GARBAGE_COLLECTION, [this] { g_luaEnvironment().collectGarbage(); }, "Calling GC"
 	);
+	// Picks up bans added by the website or directly in the database, and expires old ones
+	g_dispatcher().cycleEvent(
+		EVENT_BANS_RELOAD_INTERVAL, [] { IOBan::reloadBansAsync(); }, "IOBan::reloadBansAsync"
+	);
 	auto marketItemsPriceIntervalMinutes = g_configManager().getNumber(MARKET_REFRESH_PRICES);
 	if (marketItemsPriceIntervalMinutes > 0) {
 		auto marketItemsPriceIntervalMS = marketItemsPriceIntervalMinutes * 60000;
@@ -884,7 +889,7 @@ void Game::internalGetPosition(std::shared_ptr<Item> item, Position &pos, uint8_
 std::shared_ptr<Creature> Game::getCreatureByID(uint32_t id) {
 	if (id >= Player::getFirstID() && id <= Player::getLastID()) {
 		return getPlayerByID(id);
-	} else if (id <= Monster::monsterAutoID) {
+	} else if (MonsterRegistry::contains_id(id)) {
 		return getMonsterByID(id);
 	} else if (id <= Npc::npcAutoID) {
 		return getNpcByID(id);
@@ -895,15 +900,15 @@ std::shared_ptr<Creature> Game::getCreatureByID(uint32_t id) {
 }
 
 std::shared_ptr<Monster> Game::getMonsterByID(uint32_t id) {
-	if (id == 0) {
-		return nullptr;
-	}
+	return monsters.get(id);
+}
 
-	auto it = monsters.find(id);
-	if (it == monsters.end()) {
-		return nullptr;
+uint32_t Game::reserveMonsterID() {
+	const auto id = monsters.allocate();
+	if (id == 0) {
+		g_logger().error("[{}] - Ran out of monster ids", __FUNCTION__);
 	}
-	return it->second;
+	return id;
 }
 
 std::shared_ptr<Npc> Game::getNpcByID(uint32_t id) {
@@ -953,9 +958,9 @@ std::shared_ptr<Creature> Game::getCreatureByName(const std::string &s) {
 		}
 	}
 
-	for (const auto &it : monsters) {
-		if (lowerCaseName == asLowerCaseString(it.second->getName())) {
-			return it.second;
+	for (const auto &monster : monsters) {
+		if (lowerCaseName == asLowerCaseString(monster->getName())) {
+			return monster;
 		}
 	}
 	return nullptr;
@@ -6317,11 +6322,12 @@ bool Game::internalCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses
 		spectators = (*spectatorsPtr);
 	}
 
-	// Send to client
+	// Send to client, the packet is the same for every listener
+	SharedNetworkMessage message;
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
 			if (!ghostMode || tmpPlayer->canSeeCreature(creature)) {
-				tmpPlayer->sendCreatureSay(creature, type, text, pos);
+				tmpPlayer->sendCreatureSay(creature, type, text, pos, message);
 			}
 		}
 	}
@@ -6414,8 +6420,9 @@ void Game::changeSpeed(std::shared_ptr<Creature> creature, int32_t varSpeedDelta
 	creature->setSpeed(varSpeed);
 
 	// Send to clients
+	SharedNetworkMessage message;
 	for (const auto &spectator : Spectators().find<Player>(creature->getPosition())) {
-		spectator->getPlayer()->sendChangeSpeed(creature, creature->getStepSpeed());
+		spectator->getPlayer()->sendChangeSpeed(creature, creature->getStepSpeed(), message);
 	}
 }
 
@@ -6423,8 +6430,9 @@ void Game::setCreatureSpeed(std::shared_ptr<Creature> creature, int32_t speed) {
 	creature->setBaseSpeed(static_cast<uint16_t>(speed));
 
 	// Send creature speed to client
+	SharedNetworkMessage message;
 	for (const auto &spectator : Spectators().find<Player>(creature->getPosition())) {
-		spectator->getPlayer()->sendChangeSpeed(creature, creature->getStepSpeed());
+		spectator->getPlayer()->sendChangeSpeed(creature, creature->getStepSpeed(), message);
 	}
 }
 
@@ -6435,8 +6443,9 @@ void Game::changePlayerSpeed(const std::shared_ptr<Player> &player, int32_t varS
 	player->setSpeed(varSpeed);
 
 	// Send new player speed to the spectators
+	SharedNetworkMessage message;
 	for (const auto &creatureSpectator : Spectators().find<Player>(player->getPosition())) {
-		creatureSpectator->getPlayer()->sendChangeSpeed(player, player->getStepSpeed());
+		creatureSpectator->getPlayer()->sendChangeSpeed(player, player->getStepSpeed(), message);
 	}
 }
 
@@ -7883,9 +7892,10 @@ void Game::addCreatureHealth(const CreatureVector &spectators, std::shared_ptr<C
 			}
 		}
 	}
+	SharedNetworkMessage message;
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
-			tmpPlayer->sendCreatureHealth(target);
+			tmpPlayer->sendCreatureHealth(target, message);
 		}
 	}
 }
@@ -7913,9 +7923,10 @@ void Game::addMagicEffect(const Position &pos, uint16_t effect) {
 }
 
 void Game::addMagicEffect(const CreatureVector &spectators, const Position &pos, uint16_t effect) {
+	SharedNetworkMessage message;
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
-			tmpPlayer->sendMagicEffect(pos, effect);
+			tmpPlayer->sendMagicEffect(pos, effect, message);
 		}
 	}
 }
@@ -7939,9 +7950,10 @@ void Game::addDistanceEffect(const Position &fromPos, const Position &toPos, uin
 }
 
 void Game::addDistanceEffect(const CreatureVector &spectators, const Position &fromPos, const Position &toPos, uint16_t effect) {
+	SharedNetworkMessage message;
 	for (const auto &spectator : spectators) {
 		if (const auto &tmpPlayer = spectator->getPlayer()) {
-			tmpPlayer->sendDistanceShoot(fromPos, toPos, effect);
+			tmpPlayer->sendDistanceShoot(fromPos, toPos, effect, message);
 		}
 	}
 }
@@ -9842,7 +9854,9 @@ void Game::removeNpc(std::shared_ptr<Npc> npc) {
 }
 
 void Game::addMonster(std::shared_ptr<Monster> monster) {
-	monsters[monster->getID()] = monster;
+	if (!monsters.set(monster->getID(), monster)) {
+		g_logger().error("[{}] - Monster {} has an invalid id {}", __FUNCTION__, monster->getName(), monster->getID());
+	}
 }
 
 void Game::removeMonster(std::shared_ptr<Monster> monster) {
@@ -10059,7 +10073,7 @@ uint32_t Game::makeFiendishMonster(uint32_t forgeableMonsterId /* = 0*/, bool cr
 		forgeableMonsters.clear();
 		// If the forgeable monsters haven't been created
 		// Then we'll create them so they don't return in the next if (forgeableMonsters.empty())
-		for (auto [monsterId, monster] : monsters) {
+		for (const auto &monster : monsters) {
 			auto monsterTile = monster->getTile();
 			if (!monster || !monsterTile) {
 				continue;
@@ -10228,7 +10242,7 @@ bool Game::removeFiendishMonster(uint32_t id, bool create /* = true*/) {
 
 void Game::updateForgeableMonsters() {
 	forgeableMonsters.clear();
-	for (auto [monsterId, monster] : monsters) {
+	for (const auto &monster : monsters) {
 		auto monsterTile = monster->getTile();
 		if (!monsterTile) {
 			continue;
@@ -22,6 +22,7 @@
 #include "lua/creature/raids.hpp"
 #include "creatures/players/grouping/team_finder.hpp"
 #include "utils/wildcardtree.hpp"
+#include "utils/slot_map.hpp"
 #include "items/items_classification.hpp"
 #include "modal_window/modal_window.hpp"
 #include "enums/object_category.hpp"
@@ -60,10 +61,14 @@ static constexpr int32_t EVENT_DECAYINTERVAL = 250;
 static constexpr int32_t EVENT_DECAY_BUCKETS = 4;
 static constexpr int32_t EVENT_FORGEABLEMONSTERCHECKINTERVAL = 300000;
 static constexpr int32_t EVENT_LUA_GARBAGE_COLLECTION = 60000 * 10; // 10min
+static constexpr int32_t EVENT_BANS_RELOAD_INTERVAL = 60000; // 1min
 
 static constexpr std::chrono::minutes CACHE_EXPIRATION_TIME { 10 }; // 10min
 static constexpr std::chrono::minutes HIGHSCORE_CACHE_EXPIRATION_TIME { 10 }; // 10min
 
+// Monster ids start right after the player ids: up to 2^18 monsters alive at once, 2^11 generations per slot
+using MonsterRegistry = stdext::slot_map<Monster, 0x50000001, 18, 11>;
+
 struct QueryHighscoreCacheEntry {
 	std::string query;
 	uint32_t page;
@@ -164,6 +169,8 @@ public:
 	std::shared_ptr<Creature> getCreatureByID(uint32_t id);
 
 	std::shared_ptr<Monster> getMonsterByID(uint32_t id);
+	// Reserves the id of a monster about to be placed, see Monster::setID
+	uint32_t reserveMonsterID();
 
 	std::shared_ptr<Npc> getNpcByID(uint32_t id);
 
@@ -544,7 +551,7 @@ public:
 	const phmap::parallel_flat_hash_map<uint32_t, std::shared_ptr<Player>> &getPlayers() const {
 		return players;
 	}
-	const std::map<uint32_t, std::shared_ptr<Monster>> &getMonsters() const {
+	const MonsterRegistry &getMonsters() const {
 		return monsters;
 	}
 	const std::map<uint32_t, std::shared_ptr<Npc>> &getNpcs() const {
@@ -877,7 +884,7 @@ private:
 	std::shared_ptr<WildcardTreeNode> wildcardTree;
 
 	std::map<uint32_t, std::shared_ptr<Npc>> npcs;
-	std::map<uint32_t, std::shared_ptr<Monster>> monsters;
+	MonsterRegistry monsters;
 	std::vector<uint32_t> forgeableMonsters;
 
 	std::map<uint32_t, std::unique_ptr<TeamFinder>> teamFinderMap; // [leaderGUID] = TeamFinder*
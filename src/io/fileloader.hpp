@@ -126,10 +126,14 @@ public:
 		buffer.clear();
 	}
 
+	void reserve(size_t size) {
+		buffer.reserve(size);
+	}
+
 	template <typename T>
 	void write(T add) {
-		char* addr = reinterpret_cast<char*>(&add);
-		std::copy(addr, addr + sizeof(T), std::back_inserter(buffer));
+		const char* addr = reinterpret_cast<const char*>(&add);
+		buffer.insert(buffer.end(), addr, addr + sizeof(T));
 	}
 
 	void writeString(const std::string &str) {
@@ -140,7 +144,7 @@ public:
 		}
 
 		write(static_cast<uint16_t>(strLength));
-		std::copy(str.begin(), str.end(), std::back_inserter(buffer));
+		buffer.insert(buffer.end(), str.begin(), str.end());
 	}
 
 private:
@@ -229,6 +229,7 @@ bool IOLoginDataSave::savePlayerFirst(std::shared_ptr<Player> player) {
 
 	// serialize conditions
 	PropWriteStream propWriteStream;
+	player->syncConditions();
 	for (const auto &condition : player->conditions) {
 		if (condition->isPersistent()) {
 			condition->serialize(propWriteStream);
@@ -244,16 +244,7 @@ charmRune_t IOBestiary::getCharmFromTarget(std::shared_ptr<Player> player, const
 		return CHARM_NONE;
 	}
 
-	uint16_t bestiaryEntry = mtype->info.raceid;
-	std::list<charmRune_t> usedRunes = getCharmUsedRuneBitAll(player);
-
-	for (charmRune_t it : usedRunes) {
-		const auto charm = getBestiaryCharm(it);
-		if (bestiaryEntry == player->parseRacebyCharm(charm->id, false, 0)) {
-			return charm->id;
-		}
-	}
-	return CHARM_NONE;
+	return player->getCharmRuneByRace(mtype->info.raceid);
 }
 
 bool IOBestiary::hasCharmUnlockedRuneBit(const std::shared_ptr<Charm> charm, int32_t input) const {
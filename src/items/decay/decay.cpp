@@ -45,23 +45,17 @@ void Decay::startDecay(const std::shared_ptr<Item> &item) {
 			stopDecay(item);
 		}
 
-		int64_t timestamp = OTSYS_TIME() + duration;
-		if (decayMap.empty()) {
-			eventId = g_dispatcher().scheduleEvent(
-				std::max<int32_t>(SCHEDULER_MINTICKS, duration), [this] { checkDecay(); }, "Decay::checkDecay"
+		if (eventId == 0) {
+			lastTick = OTSYS_TIME() / DECAY_TICK_INTERVAL;
+			eventId = g_dispatcher().cycleEvent(
+				static_cast<uint32_t>(DECAY_TICK_INTERVAL), [this] { checkDecay(); }, "Decay::checkDecay"
 			);
-		} else {
-			if (timestamp < decayMap.begin()->first) {
-				g_dispatcher().stopEvent(eventId);
-				eventId = g_dispatcher().scheduleEvent(
-					std::max<int32_t>(SCHEDULER_MINTICKS, duration), [this] { checkDecay(); }, "Decay::checkDecay"
-				);
-			}
 		}
 
+		int64_t timestamp = OTSYS_TIME() + duration;
 		item->setDecaying(DECAYING_TRUE);
 		item->setAttribute(ItemAttribute_t::DURATION_TIMESTAMP, timestamp);
-		decayMap[timestamp].push_back(item);
+		linkItem(item, timestamp);
 	}
 }
 
@@ -70,41 +64,14 @@ void Decay::stopDecay(const std::shared_ptr<Item> &item) {
 		return;
 	}
 	if (item->hasAttribute(ItemAttribute_t::DECAYSTATE)) {
-		auto timestamp = item->getAttribute<int64_t>(ItemAttribute_t::DURATION_TIMESTAMP);
 		if (item->hasAttribute(ItemAttribute_t::DURATION_TIMESTAMP)) {
-			auto it = decayMap.find(timestamp);
-			if (it != decayMap.end()) {
-				auto &decayItems = it->second;
-
-				size_t i = 0, end = decayItems.size();
-				auto decayItem = decayItems[i];
-				if (end == 1) {
-					if (item == decayItem) {
-						if (item->hasAttribute(ItemAttribute_t::DURATION)) {
-							// Incase we removed duration attribute don't assign new duration
-							item->setDuration(item->getDuration());
-						}
-						item->removeAttribute(ItemAttribute_t::DECAYSTATE);
-
-						decayMap.erase(it);
-					}
-					return;
-				}
-				while (i < end) {
-					decayItem = decayItems[i];
-					if (item == decayItem) {
-						if (item->hasAttribute(ItemAttribute_t::DURATION)) {
-							// Incase we removed duration attribute don't assign new duration
-							item->setDuration(item->getDuration());
-						}
-						item->removeAttribute(ItemAttribute_t::DECAYSTATE);
-
-						decayItems[i] = decayItems.back();
-						decayItems.pop_back();
-						return;
-					}
-					++i;
+			if (unlinkItem(item)) {
+				if (item->hasAttribute(ItemAttribute_t::DURATION)) {
+					// Incase we removed duration attribute don't assign new duration
+					item->setDuration(item->getDuration());
 				}
+				item->removeAttribute(ItemAttribute_t::DECAYSTATE);
+				return;
 			}
 			item->removeAttribute(ItemAttribute_t::DURATION_TIMESTAMP);
 		} else {
@@ -114,27 +81,35 @@ void Decay::stopDecay(const std::shared_ptr<Item> &item) {
 }
 
 void Decay::checkDecay() {
-	int64_t timestamp = OTSYS_TIME();
+	const int64_t timestamp = OTSYS_TIME();
+	const int64_t currentTick = timestamp / DECAY_TICK_INTERVAL;
 
-	std::vector<std::shared_ptr<Item>> tempItems;
+	std::vector<DecayEntry> tempItems;
 	tempItems.reserve(32); // Small preallocation
 
-	auto it = decayMap.begin(), end = decayMap.end();
-	while (it != end) {
-		if (it->first > timestamp) {
-			break;
-		}
+	// Walk every slot passed since the last tick, the dispatcher may have been late; one full rotation covers the whole wheel
+	const int64_t firstTick = std::max<int64_t>(lastTick + 1, currentTick - static_cast<int64_t>(DECAY_WHEEL_SIZE) + 1);
+	for (int64_t tick = firstTick; tick <= currentTick; ++tick) {
+		auto &slot = wheel[static_cast<size_t>(tick) % DECAY_WHEEL_SIZE];
+		size_t i = 0;
+		while (i < slot.size()) {
+			// Items of later rounds share the slot and stay linked
+			if (slot[i].timestamp > timestamp) {
+				++i;
+				continue;
+			}
 
-		// Iterating here is unsafe so let's copy our items into temporary vector
-		auto &decayItems = it->second;
-		tempItems.reserve(tempItems.size() + decayItems.size());
-		for (auto &decayItem : decayItems) {
-			tempItems.push_back(decayItem);
+			// Iterating here is unsafe so let's move our items into a temporary vector
+			tempItems.emplace_back(slot[i]);
+			unlinkSlotEntry(slot, i);
 		}
-		it = decayMap.erase(it);
 	}
+	lastTick = std::max(lastTick, currentTick);
 
-	for (const auto &item : tempItems) {
+	// Keep the expiration order of the items within the processed ticks
+	std::ranges::stable_sort(tempItems, {}, &DecayEntry::timestamp);
+	for (const auto &entry : tempItems) {
+		const auto &item = entry.item;
 		if (!item->canDecay()) {
 			item->setDuration(item->getDuration());
 			item->setDecaying(DECAYING_FALSE);
@@ -143,12 +118,42 @@ void Decay::checkDecay() {
 			internalDecayItem(item);
 		}
 	}
+}
+
+void Decay::linkItem(const std::shared_ptr<Item> &item, int64_t timestamp) {
+	// The first tick starting at or after the timestamp, so the item is always due when its slot is walked
+	const int64_t tick = std::max<int64_t>((timestamp + DECAY_TICK_INTERVAL - 1) / DECAY_TICK_INTERVAL, lastTick + 1);
+	const auto slotId = static_cast<size_t>(tick) % DECAY_WHEEL_SIZE;
+
+	auto &slot = wheel[slotId];
+	item->decaySlot = static_cast<int32_t>(slotId);
+	item->decaySlotIndex = static_cast<uint32_t>(slot.size());
+	slot.push_back({ item, timestamp });
+}
+
+bool Decay::unlinkItem(const std::shared_ptr<Item> &item) {
+	if (item->decaySlot < 0) {
+		return false;
+	}
+
+	auto &slot = wheel[static_cast<size_t>(item->decaySlot)];
+	const size_t index = item->decaySlotIndex;
+	if (index >= slot.size() || slot[index].item != item) {
+		item->decaySlot = -1;
+		return false;
+	}
+
+	unlinkSlotEntry(slot, index);
+	return true;
+}
 
-	if (it != end) {
-		eventId = g_dispatcher().scheduleEvent(
-			std::max<int32_t>(SCHEDULER_MINTICKS, static_cast<int32_t>(it->first - timestamp)), [this] { checkDecay(); }, "Decay::checkDecay"
-		);
+void Decay::unlinkSlotEntry(std::vector<DecayEntry> &slot, size_t index) {
+	slot[index].item->decaySlot = -1;
+	if (index + 1 != slot.size()) {
+		slot[index] = std::move(slot.back());
+		slot[index].item->decaySlotIndex = static_cast<uint32_t>(index);
 	}
+	slot.pop_back();
 }
 
 void Decay::internalDecayItem(const std::shared_ptr<Item> &item) {
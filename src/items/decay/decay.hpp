@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "game/scheduling/dispatcher.hpp"
+
 class Item;
 
 class Decay {
@@ -24,12 +26,27 @@ public:
 	void stopDecay(const std::shared_ptr<Item> &item);
 
 private:
+	// Resolution of the time wheel, every slot holds the items expiring within one tick
+	static constexpr int64_t DECAY_TICK_INTERVAL = SCHEDULER_MINTICKS;
+	// Number of slots, one wheel rotation spans DECAY_WHEEL_SIZE * DECAY_TICK_INTERVAL ms, later items wait for their round
+	static constexpr size_t DECAY_WHEEL_SIZE = 4096;
+
+	struct DecayEntry {
+		std::shared_ptr<Item> item;
+		int64_t timestamp;
+	};
+
 	void checkDecay();
 	void internalDecayItem(const std::shared_ptr<Item> &item);
 
-	uint32_t eventId { 0 };
-	// order is important, so we use an std::map
-	std::map<int64_t, std::vector<std::shared_ptr<Item>>> decayMap;
+	void linkItem(const std::shared_ptr<Item> &item, int64_t timestamp);
+	bool unlinkItem(const std::shared_ptr<Item> &item);
+	void unlinkSlotEntry(std::vector<DecayEntry> &slot, size_t index);
+
+	uint64_t eventId { 0 };
+	int64_t lastTick { 0 };
+	// Items are linked intrusively through Item::decaySlot/decaySlotIndex, so starting and stopping is O(1)
+	std::array<std::vector<DecayEntry>, DECAY_WHEEL_SIZE> wheel;
 };
 
 constexpr auto g_decay = Decay::getInstance;
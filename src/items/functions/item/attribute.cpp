@@ -9,6 +9,55 @@
 
 #include "items/functions/item/attribute.hpp"
 
+/*
+=============================
+* AttributeStringPool
+=============================
+*/
+namespace {
+	// Leaked on purpose: items released during static destruction still return their strings to the pool
+	AttributeStringPool &getAttributeStringPool() {
+		static auto* pool = new AttributeStringPool();
+		return *pool;
+	}
+}
+
+std::shared_ptr<const std::string> AttributeStringPool::intern(const std::string &value) {
+	if (value.empty()) {
+		return getEmpty();
+	}
+
+	auto &pool = getAttributeStringPool();
+	std::scoped_lock lock(pool.mutex);
+	if (auto it = pool.strings.find(std::string_view(value)); it != pool.strings.end()) {
+		if (auto shared = it->second.lock()) {
+			return shared;
+		}
+		// The last owner is being released; its deleter will find the new entry and leave it alone
+		pool.strings.erase(it);
+	}
+
+	std::shared_ptr<const std::string> shared(new std::string(value), &AttributeStringPool::release);
+	pool.strings.emplace(std::string_view(*shared), shared);
+	return shared;
+}
+
+const std::shared_ptr<const std::string> &AttributeStringPool::getEmpty() {
+	static const auto empty = std::make_shared<const std::string>();
+	return empty;
+}
+
+void AttributeStringPool::release(const std::string* value) {
+	auto &pool = getAttributeStringPool();
+	{
+		std::scoped_lock lock(pool.mutex);
+		if (auto it = pool.strings.find(std::string_view(*value)); it != pool.strings.end() && it->second.expired()) {
+			pool.strings.erase(it);
+		}
+	}
+	delete value;
+}
+
 /*
 =============================
 * ItemAttribute class (Attributes methods)
@@ -100,48 +149,71 @@ bool ItemAttribute::removeAttribute(ItemAttribute_t type) {
 * CustomAttribute map methods
 =============================
 */
-const std::map<std::string, CustomAttribute, std::less<>> &ItemAttribute::getCustomAttributeMap() const {
+const CustomAttributeMap &ItemAttribute::getCustomAttributeMap() const {
 	return customAttributeMap;
 }
 
+CustomAttributeMap::iterator ItemAttribute::findCustomAttribute(const std::string &lowerName) {
+	auto it = std::ranges::lower_bound(customAttributeMap, lowerName, {}, &CustomAttributeMap::value_type::first);
+	if (it != customAttributeMap.end() && it->first == lowerName) {
+		return it;
+	}
+	return customAttributeMap.end();
+}
+
+CustomAttributeMap::const_iterator ItemAttribute::findCustomAttribute(const std::string &lowerName) const {
+	auto it = std::ranges::lower_bound(customAttributeMap, lowerName, {}, &CustomAttributeMap::value_type::first);
+	if (it != customAttributeMap.end() && it->first == lowerName) {
+		return it;
+	}
+	return customAttributeMap.end();
+}
+
+void ItemAttribute::insertCustomAttribute(const std::string &key, const CustomAttribute &customAttribute) {
+	auto lowerKey = asLowerCaseString(key);
+	auto it = std::ranges::lower_bound(customAttributeMap, lowerKey, {}, &CustomAttributeMap::value_type::first);
+	if (it != customAttributeMap.end() && it->first == lowerKey) {
+		it->second = customAttribute;
+		return;
+	}
+
+	customAttributeMap.emplace(it, std::move(lowerKey), customAttribute);
+}
+
 /*
 =============================
 * CustomAttribute object methods
 =============================
 */
 const CustomAttribute* ItemAttribute::getCustomAttribute(const std::string &attributeName) const {
-	if (customAttributeMap.contains(asLowerCaseString(attributeName))) {
-		return &customAttributeMap.at(asLowerCaseString(attributeName));
+	if (auto it = findCustomAttribute(asLowerCaseString(attributeName)); it != customAttributeMap.end()) {
+		return &it->second;
 	}
 	return nullptr;
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const int64_t value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	insertCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const std::string &value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	insertCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const double value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	insertCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::setCustomAttribute(const std::string &key, const bool value) {
-	CustomAttribute attribute(key, value);
-	customAttributeMap[asLowerCaseString(key)] = attribute;
+	insertCustomAttribute(key, CustomAttribute(key, value));
 }
 
 void ItemAttribute::addCustomAttribute(const std::string &key, const CustomAttribute &customAttribute) {
-	customAttributeMap[asLowerCaseString(key)] = customAttribute;
+	insertCustomAttribute(key, customAttribute);
 }
 
 bool ItemAttribute::removeCustomAttribute(const std::string &attributeName) {
-	auto it = customAttributeMap.find(asLowerCaseString(attributeName));
+	auto it = findCustomAttribute(asLowerCaseString(attributeName));
 	if (it == customAttributeMap.end()) {
 		return false;
 	}
@@ -66,6 +66,25 @@ public:
 	}
 };
 
+/**
+ * @brief Interns the string values of item attributes.
+ *
+ * Items that share a text, writer or description (map decorations, loot, depot
+ * duplicates) point to the same immutable string instead of owning a copy.
+ * Entries remove themselves from the pool when the last item referencing them goes away.
+ */
+class AttributeStringPool {
+public:
+	static std::shared_ptr<const std::string> intern(const std::string &value);
+	static const std::shared_ptr<const std::string> &getEmpty();
+
+private:
+	static void release(const std::string* value);
+
+	std::mutex mutex;
+	phmap::flat_hash_map<std::string_view, std::weak_ptr<const std::string>> strings;
+};
+
 class Attributes : public ItemAttributeHelper {
 public:
 	explicit Attributes(ItemAttribute_t type) :
@@ -87,12 +106,12 @@ public:
 		return type;
 	}
 
-	std::variant<int64_t, std::shared_ptr<std::string>> getDefaultValueForType(ItemAttribute_t attributeType) const {
+	std::variant<int64_t, std::shared_ptr<const std::string>> getDefaultValueForType(ItemAttribute_t attributeType) const {
 		ItemAttributeHelper helper;
 		if (helper.isAttributeInteger(attributeType)) {
 			return 0;
 		} else if (helper.isAttributeString(attributeType)) {
-			return std::make_shared<std::string>();
+			return AttributeStringPool::getEmpty();
 		} else {
 			return {};
 		}
@@ -104,8 +123,8 @@ public:
 		}
 	}
 	void setValue(const std::string &newValue) {
-		if (std::holds_alternative<std::shared_ptr<std::string>>(value)) {
-			value = std::make_shared<std::string>(newValue);
+		if (std::holds_alternative<std::shared_ptr<const std::string>>(value)) {
+			value = AttributeStringPool::intern(newValue);
 		}
 	}
 	const int64_t &getInteger() const {
@@ -116,25 +135,30 @@ public:
 		return emptyValue;
 	}
 
-	const std::shared_ptr<std::string> getString() const {
-		if (std::holds_alternative<std::shared_ptr<std::string>>(value)) {
-			return std::get<std::shared_ptr<std::string>>(value);
+	const std::shared_ptr<const std::string> &getString() const {
+		if (std::holds_alternative<std::shared_ptr<const std::string>>(value)) {
+			return std::get<std::shared_ptr<const std::string>>(value);
 		}
-		static std::shared_ptr<std::string> emptyPtr;
+		static std::shared_ptr<const std::string> emptyPtr;
 		return emptyPtr;
 	}
 
 private:
 	ItemAttribute_t type;
-	std::variant<int64_t, std::shared_ptr<std::string>> value;
+	std::variant<int64_t, std::shared_ptr<const std::string>> value;
 };
 
+// Most items carry one or two attributes (action id, duration, charges), so they are kept inline
+using AttributeVector = absl::InlinedVector<Attributes, 2>;
+// Sorted by key; items rarely have more than a handful of custom attributes
+using CustomAttributeMap = std::vector<std::pair<std::string, CustomAttribute>>;
+
 class ItemAttribute : public ItemAttributeHelper {
 public:
 	ItemAttribute() = default;
 
 	// CustomAttribute map methods
-	const std::map<std::string, CustomAttribute, std::less<>> &getCustomAttributeMap() const;
+	const CustomAttributeMap &getCustomAttributeMap() const;
 	// CustomAttribute object methods
 	const CustomAttribute* getCustomAttribute(const std::string &attributeName) const;
 
@@ -153,7 +177,7 @@ public:
 	const std::string &getAttributeString(ItemAttribute_t type) const;
 	const int64_t &getAttributeValue(ItemAttribute_t type) const;
 
-	const std::vector<Attributes> &getAttributeVector() const {
+	const AttributeVector &getAttributeVector() const {
 		return attributeVector;
 	}
 
@@ -171,6 +195,10 @@ public:
 	Attributes &getAttributesByType(ItemAttribute_t type);
 
 private:
-	std::map<std::string, CustomAttribute, std::less<>> customAttributeMap;
-	std::vector<Attributes> attributeVector;
+	CustomAttributeMap::iterator findCustomAttribute(const std::string &lowerName);
+	CustomAttributeMap::const_iterator findCustomAttribute(const std::string &lowerName) const;
+	void insertCustomAttribute(const std::string &key, const CustomAttribute &customAttribute);
+
+	CustomAttributeMap customAttributeMap;
+	AttributeVector attributeVector;
 };
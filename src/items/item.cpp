@@ -868,6 +868,11 @@ void Item::serializeAttr(PropWriteStream &propWriteStream) const {
 		propWriteStream.write<uint8_t>(getSubType());
 	}
 
+	// Everything below is attribute backed; most map and depot items have none
+	if (!isInitializedAttributePtr()) {
+		return;
+	}
+
 	if (auto charges = getAttribute<uint16_t>(ItemAttribute_t::CHARGES)) {
 		propWriteStream.write<uint8_t>(ATTR_CHARGES);
 		propWriteStream.write<uint16_t>(charges);
@@ -1006,7 +1011,7 @@ void Item::serializeAttr(PropWriteStream &propWriteStream) const {
 
 	// Serialize custom attributes, only serialize if the map not is empty
 	if (hasCustomAttribute()) {
-		auto customAttributeMap = getCustomAttributeMap();
+		const auto &customAttributeMap = getCustomAttributeMap();
 		propWriteStream.write<uint8_t>(ATTR_CUSTOM);
 		propWriteStream.write<uint64_t>(customAttributeMap.size());
 		for (const auto &[attributeKey, customAttribute] : customAttributeMap) {
@@ -1070,32 +1075,31 @@ std::string Item::getOwnerName() const {
 }
 
 bool Item::hasProperty(ItemProperty prop) const {
-	const ItemType &it = items[id];
 	switch (prop) {
 		case CONST_PROP_BLOCKSOLID:
-			return it.blockSolid;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKSOLID);
 		case CONST_PROP_MOVABLE:
 			return canBeMoved();
 		case CONST_PROP_HASHEIGHT:
-			return it.hasHeight;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_HASHEIGHT);
 		case CONST_PROP_BLOCKPROJECTILE:
-			return it.blockProjectile;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKPROJECTILE);
 		case CONST_PROP_BLOCKPATH:
-			return it.blockPathFind;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKPATHFIND);
 		case CONST_PROP_ISVERTICAL:
-			return it.isVertical;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_VERTICAL);
 		case CONST_PROP_ISHORIZONTAL:
-			return it.isHorizontal;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_HORIZONTAL);
 		case CONST_PROP_IMMOVABLEBLOCKSOLID:
-			return it.blockSolid && !canBeMoved();
+			return items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKSOLID) && !canBeMoved();
 		case CONST_PROP_IMMOVABLEBLOCKPATH:
-			return it.blockPathFind && !canBeMoved();
+			return items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKPATHFIND) && !canBeMoved();
 		case CONST_PROP_IMMOVABLENOFIELDBLOCKPATH:
-			return !it.isMagicField() && it.blockPathFind && !canBeMoved();
+			return !items.hasFlag(id, ITEM_TYPE_FLAG_MAGICFIELD) && items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKPATHFIND) && !canBeMoved();
 		case CONST_PROP_NOFIELDBLOCKPATH:
-			return !it.isMagicField() && it.blockPathFind;
+			return !items.hasFlag(id, ITEM_TYPE_FLAG_MAGICFIELD) && items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKPATHFIND);
 		case CONST_PROP_SUPPORTHANGABLE:
-			return it.isHorizontal || it.isVertical;
+			return items.hasFlag(id, ITEM_TYPE_FLAG_HORIZONTAL) || items.hasFlag(id, ITEM_TYPE_FLAG_VERTICAL);
 		default:
 			return false;
 	}
@@ -31,7 +31,7 @@ class BedItem;
 class Imbuement;
 class Item;
 
-// This class ItemProperties that serves as an interface to access and modify attributes of an item. The item's attributes are stored in an instance of ItemAttribute. The class ItemProperties has methods to get and set integer and string attributes, check if an attribute exists, remove an attribute, get the underlying attribute bits, and get a vector of attributes. It also has methods to get and set custom attributes, which are stored in a std::map<std::string, CustomAttribute, std::less<>>. The class has a data member attributePtr of type std::unique_ptr<ItemAttribute> that stores a pointer to the item's attributes methods.
+// This class ItemProperties that serves as an interface to access and modify attributes of an item. The item's attributes are stored in an instance of ItemAttribute. The class ItemProperties has methods to get and set integer and string attributes, check if an attribute exists, remove an attribute, get the underlying attribute bits, and get a vector of attributes. It also has methods to get and set custom attributes, which are stored in a sorted CustomAttributeMap. The class has a data member attributePtr of type std::unique_ptr<ItemAttribute> that stores a pointer to the item's attributes methods.
 class ItemProperties {
 public:
 	template <typename T>
@@ -68,16 +68,16 @@ public:
 	}
 
 	bool isAttributeInteger(ItemAttribute_t type) const {
-		return initAttributePtr()->isAttributeInteger(type);
+		return ItemAttributeHelper().isAttributeInteger(type);
 	}
 
 	bool isAttributeString(ItemAttribute_t type) const {
-		return initAttributePtr()->isAttributeString(type);
+		return ItemAttributeHelper().isAttributeString(type);
 	}
 
 	// Custom Attributes
-	const std::map<std::string, CustomAttribute, std::less<>> &getCustomAttributeMap() const {
-		static std::map<std::string, CustomAttribute, std::less<>> map = {};
+	const CustomAttributeMap &getCustomAttributeMap() const {
+		static CustomAttributeMap map = {};
 		if (!attributePtr) {
 			return map;
 		}
@@ -172,8 +172,8 @@ protected:
 		return attributePtr;
 	}
 
-	const std::vector<Attributes> &getAttributeVector() const {
-		static std::vector<Attributes> emptyVector = {};
+	const AttributeVector &getAttributeVector() const {
+		static AttributeVector emptyVector = {};
 		if (!attributePtr) {
 			return emptyVector;
 		}
@@ -352,7 +352,7 @@ public:
 		if (hasAttribute(ItemAttribute_t::WEIGHT)) {
 			return getAttribute<uint32_t>(ItemAttribute_t::WEIGHT);
 		}
-		return items[id].weight;
+		return items.getWeight(id);
 	}
 
 	int32_t getCleavePercent() const {
@@ -471,46 +471,46 @@ public:
 
 	bool hasProperty(ItemProperty prop) const;
 	bool isBlocking() const {
-		return items[id].blockSolid;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_BLOCKSOLID);
 	}
 	bool isStackable() const {
-		return items[id].stackable;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_STACKABLE);
 	}
 	bool isStowable() const {
 		return items[id].stackable && items[id].wareId > 0;
 	}
 	bool isAlwaysOnTop() const {
-		return items[id].alwaysOnTopOrder != 0;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_ALWAYSONTOP);
 	}
 	bool isGroundTile() const {
-		return items[id].isGroundTile();
+		return items.getGroup(id) == ITEM_GROUP_GROUND;
 	}
 	bool isMagicField() const {
-		return items[id].isMagicField();
+		return items.hasFlag(id, ITEM_TYPE_FLAG_MAGICFIELD);
 	}
 	bool isWrapContainer() const {
 		return items[id].wrapContainer;
 	}
 	bool isMovable() const {
-		return items[id].movable;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_MOVABLE);
 	}
 	bool isCorpse() const {
-		return items[id].isCorpse;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_CORPSE);
 	}
 	bool isPickupable() const {
-		return items[id].pickupable;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_PICKUPABLE);
 	}
 	bool isMultiUse() const {
 		return items[id].multiUse;
 	}
 	bool isHangable() const {
-		return items[id].isHangable;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_HANGABLE);
 	}
 	bool isRotatable() const {
 		return items[id].rotatable && items[id].rotateTo;
 	}
 	bool isPodium() const {
-		return items[id].isPodium;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_PODIUM);
 	}
 	bool isWrapable() const {
 		return items[id].wrapable && items[id].wrapableTo;
@@ -525,7 +525,7 @@ public:
 		return items[id].isAmmo();
 	}
 	bool hasWalkStack() const {
-		return items[id].walkStack;
+		return items.hasFlag(id, ITEM_TYPE_FLAG_WALKSTACK);
 	}
 	bool isQuiver() const {
 		return items[id].isQuiver();
@@ -549,7 +549,7 @@ public:
 		return items[id].isCarpet();
 	}
 	bool canReceiveAutoCarpet() const {
-		return isBlocking() && isAlwaysOnTop() && !items[id].hasHeight;
+		return isBlocking() && isAlwaysOnTop() && !items.hasFlag(id, ITEM_TYPE_FLAG_HASHEIGHT);
 	}
 	bool canBeUsedByGuests() const {
 		return isDummy() || items[id].m_canBeUsedByGuests;
@@ -804,6 +804,10 @@ protected:
 	bool isLootTrackeable = false;
 	bool decayDisabled = false;
 
+	// Intrusive link into the Decay time wheel, -1 when the item is not decaying
+	int32_t decaySlot = -1;
+	uint32_t decaySlotIndex = 0;
+
 private:
 	void setImbuement(uint8_t slot, uint16_t imbuementId, uint32_t duration);
 	// Don't add variables here, use the ItemAttribute class.
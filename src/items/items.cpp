@@ -20,6 +20,10 @@ Items::Items() = default;
 
 void Items::clear() {
 	items.clear();
+	hotFlags.clear();
+	hotWeights.clear();
+	hotSpeeds.clear();
+	hotGroups.clear();
 	ladders.clear();
 	dummys.clear();
 	nameToItems.clear();
@@ -269,9 +273,60 @@ bool Items::loadFromXml() {
 			parseItemNode(itemNode, id++);
 		}
 	}
+
+	buildHotTable();
 	return true;
 }
 
+uint32_t Items::getHotFlags(const ItemType &itemType) {
+	uint32_t flags = 0;
+	const auto set = [&flags](bool value, ItemTypeFlag_t flag) {
+		if (value) {
+			flags |= flag;
+		}
+	};
+
+	set(itemType.blockSolid, ITEM_TYPE_FLAG_BLOCKSOLID);
+	set(itemType.blockProjectile, ITEM_TYPE_FLAG_BLOCKPROJECTILE);
+	set(itemType.blockPathFind, ITEM_TYPE_FLAG_BLOCKPATHFIND);
+	set(itemType.hasHeight, ITEM_TYPE_FLAG_HASHEIGHT);
+	set(itemType.pickupable, ITEM_TYPE_FLAG_PICKUPABLE);
+	set(itemType.movable, ITEM_TYPE_FLAG_MOVABLE);
+	set(itemType.stackable, ITEM_TYPE_FLAG_STACKABLE);
+	set(itemType.isHangable, ITEM_TYPE_FLAG_HANGABLE);
+	set(itemType.isVertical, ITEM_TYPE_FLAG_VERTICAL);
+	set(itemType.isHorizontal, ITEM_TYPE_FLAG_HORIZONTAL);
+	set(itemType.walkStack, ITEM_TYPE_FLAG_WALKSTACK);
+	set(itemType.isCorpse, ITEM_TYPE_FLAG_CORPSE);
+	set(itemType.isPodium, ITEM_TYPE_FLAG_PODIUM);
+	set(itemType.alwaysOnTopOrder != 0, ITEM_TYPE_FLAG_ALWAYSONTOP);
+	set(itemType.isMagicField(), ITEM_TYPE_FLAG_MAGICFIELD);
+	return flags;
+}
+
+void Items::buildHotTable() {
+	const size_t count = items.size();
+	hotFlags.assign(count, 0);
+	hotWeights.assign(count, 0);
+	hotSpeeds.assign(count, 0);
+	hotGroups.assign(count, ITEM_GROUP_NONE);
+	for (size_t id = 0; id < count; ++id) {
+		refreshHotTable(static_cast<uint16_t>(id));
+	}
+}
+
+void Items::refreshHotTable(uint16_t id) {
+	if (id >= hotFlags.size()) {
+		return;
+	}
+
+	const ItemType &itemType = items[id];
+	hotFlags[id] = getHotFlags(itemType);
+	hotWeights[id] = itemType.weight;
+	hotSpeeds[id] = itemType.speed;
+	hotGroups[id] = static_cast<uint8_t>(itemType.group);
+}
+
 void Items::buildInventoryList() {
 	inventory.reserve(items.size());
 	for (const auto &type : items) {
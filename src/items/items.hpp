@@ -429,6 +429,43 @@ public:
 		return items.size();
 	}
 
+	/**
+	 * @brief Rebuilds the compact structure-of-arrays copy of the fields read by
+	 * the hot item checks (flags, weight, speed and group).
+	 *
+	 * Must be called once every item type has been loaded (protobuf and XML).
+	 */
+	void buildHotTable();
+	/**
+	 * @brief Refreshes a single entry of the hot table after its ItemType was changed at runtime.
+	 */
+	void refreshHotTable(uint16_t id);
+
+	bool hasFlag(size_t id, ItemTypeFlag_t flag) const {
+		if (id < hotFlags.size()) {
+			return (hotFlags[id] & flag) != 0;
+		}
+		return (getHotFlags(getItemType(id)) & flag) != 0;
+	}
+	int32_t getWeight(size_t id) const {
+		if (id < hotWeights.size()) {
+			return hotWeights[id];
+		}
+		return getItemType(id).weight;
+	}
+	uint16_t getSpeed(size_t id) const {
+		if (id < hotSpeeds.size()) {
+			return hotSpeeds[id];
+		}
+		return getItemType(id).speed;
+	}
+	ItemGroup_t getGroup(size_t id) const {
+		if (id < hotGroups.size()) {
+			return static_cast<ItemGroup_t>(hotGroups[id]);
+		}
+		return getItemType(id).group;
+	}
+
 	NameMap nameToItems;
 
 	void addLadderId(uint16_t newId) {
@@ -458,7 +495,14 @@ public:
 	}
 
 private:
+	static uint32_t getHotFlags(const ItemType &itemType);
+
 	std::vector<ItemType> items;
+	// Hot table, indexed by item id; ids past the end fall back to the ItemType itself
+	std::vector<uint32_t> hotFlags;
+	std::vector<int32_t> hotWeights;
+	std::vector<uint16_t> hotSpeeds;
+	std::vector<uint8_t> hotGroups;
 	std::vector<uint16_t> ladders;
 	std::unordered_map<uint16_t, uint16_t> dummys;
 	InventoryVector inventory;
@@ -27,6 +27,25 @@ enum ItemProperty {
 	CONST_PROP_SUPPORTHANGABLE,
 };
 
+// Packed ItemType booleans read by the hot per-item checks (see Items::buildHotTable)
+enum ItemTypeFlag_t : uint32_t {
+	ITEM_TYPE_FLAG_BLOCKSOLID = 1 << 0,
+	ITEM_TYPE_FLAG_BLOCKPROJECTILE = 1 << 1,
+	ITEM_TYPE_FLAG_BLOCKPATHFIND = 1 << 2,
+	ITEM_TYPE_FLAG_HASHEIGHT = 1 << 3,
+	ITEM_TYPE_FLAG_PICKUPABLE = 1 << 4,
+	ITEM_TYPE_FLAG_MOVABLE = 1 << 5,
+	ITEM_TYPE_FLAG_STACKABLE = 1 << 6,
+	ITEM_TYPE_FLAG_HANGABLE = 1 << 7,
+	ITEM_TYPE_FLAG_VERTICAL = 1 << 8,
+	ITEM_TYPE_FLAG_HORIZONTAL = 1 << 9,
+	ITEM_TYPE_FLAG_WALKSTACK = 1 << 10,
+	ITEM_TYPE_FLAG_CORPSE = 1 << 11,
+	ITEM_TYPE_FLAG_PODIUM = 1 << 12,
+	ITEM_TYPE_FLAG_ALWAYSONTOP = 1 << 13,
+	ITEM_TYPE_FLAG_MAGICFIELD = 1 << 14,
+};
+
 enum Attr_ReadValue {
 	ATTR_READ_CONTINUE,
 	ATTR_READ_ERROR,
@@ -750,8 +750,8 @@ ReturnValue Tile::queryAdd(int32_t, const std::shared_ptr<Thing> &thing, uint32_
 
 			if (const auto items = getItemList()) {
 				for (auto &item : *items) {
-					const ItemType &iiType = Item::items[item->getID()];
-					if (iiType.blockSolid && (!iiType.movable || item->hasAttribute(ItemAttribute_t::UNIQUEID))) {
+					const uint16_t itemId = item->getID();
+					if (Item::items.hasFlag(itemId, ITEM_TYPE_FLAG_BLOCKSOLID) && (!Item::items.hasFlag(itemId, ITEM_TYPE_FLAG_MOVABLE) || item->hasAttribute(ItemAttribute_t::UNIQUEID))) {
 						return RETURNVALUE_NOTPOSSIBLE;
 					}
 				}
@@ -803,12 +803,13 @@ ReturnValue Tile::queryAdd(int32_t, const std::shared_ptr<Thing> &thing, uint32_
 
 			if (items) {
 				for (auto &tileItem : *items) {
-					const ItemType &iiType = Item::items[tileItem->getID()];
-					if (!iiType.blockSolid || iiType.type == ITEM_TYPE_TRASHHOLDER) {
+					const uint16_t tileItemId = tileItem->getID();
+					if (!Item::items.hasFlag(tileItemId, ITEM_TYPE_FLAG_BLOCKSOLID) || Item::items[tileItemId].type == ITEM_TYPE_TRASHHOLDER) {
 						continue;
 					}
 
-					if (iiType.pickupable && !item->isMagicField() && !item->isBlocking()) {
+					const bool tileItemPickupable = Item::items.hasFlag(tileItemId, ITEM_TYPE_FLAG_PICKUPABLE);
+					if (tileItemPickupable && !item->isMagicField() && !item->isBlocking()) {
 						continue;
 					}
 
@@ -816,7 +817,7 @@ ReturnValue Tile::queryAdd(int32_t, const std::shared_ptr<Thing> &thing, uint32_
 						return RETURNVALUE_NOTENOUGHROOM;
 					}
 
-					if (!iiType.hasHeight || iiType.pickupable) {
+					if (!Item::items.hasFlag(tileItemId, ITEM_TYPE_FLAG_HASHEIGHT) || tileItemPickupable) {
 						return RETURNVALUE_NOTENOUGHROOM;
 					}
 				}
@@ -31,62 +31,357 @@ void KVStore::set(const std::string &key, const std::initializer_list<std::pair<
 }
 
 void KVStore::set(const std::string &key, const ValueWrapper &value) {
-	std::scoped_lock lock(mutex_);
-	return setLocked(key, value);
+	auto &shard = getShard(key);
+	std::scoped_lock lock(shard.mutex);
+	setLocked(shard, key, value, true);
 }
 
-void KVStore::setLocked(const std::string &key, const ValueWrapper &value) {
+KVStore::Shard &KVStore::getShard(const std::string &key) {
+	return shards_[std::hash<std::string> {}(key) % SHARD_COUNT];
+}
+
+void KVStore::setLocked(Shard &shard, const std::string &key, const ValueWrapper &value, bool dirty) {
 	logger.trace("KVStore::set({})", key);
-	auto it = store_.find(key);
-	if (it != store_.end()) {
-		it->second.first = value;
-		lruQueue_.splice(lruQueue_.begin(), lruQueue_, it->second.second);
+	if (!shard.missing.empty()) {
+		shard.missing.erase(key);
+	}
+
+	auto it = shard.entries.find(key);
+	if (it != shard.entries.end()) {
+		auto &entry = it->second;
+		if (entry.value.isDeleted() != value.isDeleted()) {
+			updateIndexLocked(shard, key, !value.isDeleted());
+		}
+		entry.value = value;
+		if (dirty && !entry.dirty) {
+			entry.dirty = true;
+			shard.dirtyKeys.emplace_back(key);
+		}
+		entry.referenced = true;
+		return;
+	}
+
+	size_t slot = shard.clock.size();
+	if (shard.entries.size() >= SHARD_SIZE) {
+		logger.debug("KVStore::set() - SHARD_SIZE reached, evicting an element");
+		slot = evictLocked(shard);
+		shard.clock[slot] = key;
+	} else {
+		shard.clock.emplace_back(key);
+	}
+
+	shard.entries.try_emplace(key, Entry { value, dirty, false, true });
+	if (dirty) {
+		shard.dirtyKeys.emplace_back(key);
+	}
+	if (!value.isDeleted()) {
+		updateIndexLocked(shard, key, true);
+	}
+}
+
+void KVStore::updateIndexLocked(Shard &shard, const std::string &key, bool indexed) {
+	if (indexed) {
+		shard.index.emplace(key);
 	} else {
-		if (store_.size() >= MAX_SIZE) {
-			logger.debug("KVStore::set() - MAX_SIZE reached, removing last element");
-			auto last = lruQueue_.end();
-			last--;
-			save(*last, store_[*last].first);
-			store_.erase(*last);
-			lruQueue_.pop_back();
+		shard.index.erase(key);
+	}
+}
+
+size_t KVStore::evictLocked(Shard &shard) {
+	size_t skippedSaving = 0;
+	while (true) {
+		const size_t slot = shard.hand;
+		shard.hand = (shard.hand + 1) % shard.clock.size();
+
+		auto it = shard.entries.find(shard.clock[slot]);
+		auto &entry = it->second;
+		if (entry.referenced) {
+			entry.referenced = false;
+			continue;
+		}
+
+		// A failed save has to find its entry to mark it dirty again, unless the whole shard is being saved
+		if (entry.saving && ++skippedSaving < shard.clock.size()) {
+			continue;
+		}
+
+		if (entry.dirty) {
+			save(it->first, entry.value);
+			if (entry.saving) {
+				shard.evictedWhileSaving.emplace(it->first);
+			}
+		}
+		if (!entry.value.isDeleted()) {
+			updateIndexLocked(shard, it->first, false);
 		}
+		shard.entries.erase(it);
 
-		lruQueue_.push_front(key);
-		store_.try_emplace(key, std::make_pair(value, lruQueue_.begin()));
+		evictions_.fetch_add(1, std::memory_order_relaxed);
+		invalidateScopes(shard.clock[slot]);
+		return slot;
+	}
+}
+
+void KVStore::invalidateScopes(std::string_view key) {
+	std::scoped_lock lock(scopesMutex_);
+	if (prefetchedScopes_.empty() && prefetchingScopes_.empty()) {
+		return;
+	}
+
+	for (auto pos = key.find('.'); pos != std::string_view::npos; pos = key.find('.', pos + 1)) {
+		const auto scope = key.substr(0, pos);
+		if (auto it = prefetchedScopes_.find(scope); it != prefetchedScopes_.end()) {
+			prefetchedScopes_.erase(it);
+		}
+		if (auto it = prefetchingScopes_.find(scope); it != prefetchingScopes_.end()) {
+			it->second = true;
+		}
 	}
 }
 
 std::optional<ValueWrapper> KVStore::get(const std::string &key, bool forceLoad /*= false */) {
 	logger.trace("KVStore::get({})", key);
-	std::scoped_lock lock(mutex_);
-	if (forceLoad || !store_.contains(key)) {
-		auto value = load(key);
-		if (value) {
-			setLocked(key, *value);
-		}
+	auto &shard = getShard(key);
+	std::scoped_lock lock(shard.mutex);
+	std::optional<ValueWrapper> value;
+	if (!forceLoad && getCachedLocked(shard, key, value)) {
 		return value;
 	}
 
-	auto &[value, lruIt] = store_[key];
-	if (value.isDeleted()) {
-		lruQueue_.splice(lruQueue_.end(), lruQueue_, lruIt);
-		return std::nullopt;
+	value = load(key);
+	if (value) {
+		setLocked(shard, key, *value, false);
+	} else {
+		setMissingLocked(shard, key);
 	}
-	lruQueue_.splice(lruQueue_.begin(), lruQueue_, lruIt);
 	return value;
 }
 
-std::unordered_set<std::string> KVStore::keys(const std::string &prefix /*= ""*/) {
-	std::scoped_lock lock(mutex_);
-	std::unordered_set<std::string> keys;
-	for (const auto &[key, value] : store_) {
-		if (key.find(prefix) == 0) {
-			std::string suffix = key.substr(prefix.size());
-			keys.insert(suffix);
+void KVStore::prefetch(const std::string &scope) {
+	std::vector<std::pair<std::string, ValueWrapper>> values;
+	prefetch(scope, values);
+}
+
+bool KVStore::prefetch(const std::string &scope, std::vector<std::pair<std::string, ValueWrapper>> &values) {
+	logger.trace("KVStore::prefetch({})", scope);
+	{
+		std::scoped_lock lock(scopesMutex_);
+		// A concurrent prefetch of the same scope shares the flag, it can only make both give up
+		prefetchingScopes_.try_emplace(scope, false);
+	}
+
+	// Loaded without the lock, the dispatcher keeps using the store meanwhile
+	values = loadScope(scope);
+
+	for (const auto &[key, value] : values) {
+		auto &shard = getShard(key);
+		std::scoped_lock lock(shard.mutex);
+		// Anything already in memory is newer than what was just loaded
+		if (!shard.entries.contains(key)) {
+			setLocked(shard, key, value, false);
+		} else if (!shard.missing.empty()) {
+			shard.missing.erase(key);
 		}
 	}
-	for (const auto &key : loadPrefix(prefix)) {
-		keys.insert(key);
+
+	// Evicting a key of the scope meanwhile, its own inserts included, dropped part of it again
+	std::scoped_lock lock(scopesMutex_);
+	auto it = prefetchingScopes_.find(scope);
+	const bool complete = it != prefetchingScopes_.end() && !it->second;
+	if (it != prefetchingScopes_.end()) {
+		prefetchingScopes_.erase(it);
+	}
+	if (complete) {
+		prefetchedScopes_.emplace(scope);
+	}
+	return complete;
+}
+
+std::vector<std::pair<std::string, ValueWrapper>> KVStore::loadScope(const std::string &scope) {
+	std::vector<std::pair<std::string, ValueWrapper>> values;
+	const auto prefix = fmt::format("{}.", scope);
+	for (const auto &suffix : loadPrefix(prefix)) {
+		auto key = prefix + suffix;
+		if (auto value = load(key)) {
+			values.emplace_back(std::move(key), std::move(*value));
+		}
+	}
+	return values;
+}
+
+bool KVStore::getCachedLocked(Shard &shard, const std::string &key, std::optional<ValueWrapper> &value) {
+	auto it = shard.entries.find(key);
+	if (it == shard.entries.end()) {
+		value = std::nullopt;
+		return isKnownMissingLocked(shard, key);
+	}
+
+	auto &entry = it->second;
+	if (entry.value.isDeleted()) {
+		// Deleted entries are the first ones to go
+		entry.referenced = false;
+		value = std::nullopt;
+		return true;
+	}
+	entry.referenced = true;
+	value = entry.value;
+	return true;
+}
+
+bool KVStore::isKnownMissingLocked(const Shard &shard, const std::string &key) {
+	return shard.missing.contains(key) || isPrefetched(key);
+}
+
+bool KVStore::isPrefetched(std::string_view key) {
+	std::scoped_lock lock(scopesMutex_);
+	if (prefetchedScopes_.empty()) {
+		return false;
+	}
+
+	for (auto pos = key.find('.'); pos != std::string_view::npos; pos = key.find('.', pos + 1)) {
+		if (prefetchedScopes_.contains(key.substr(0, pos))) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void KVStore::setMissingLocked(Shard &shard, const std::string &key) {
+	if (shard.missing.size() >= SHARD_SIZE) {
+		shard.missing.clear();
+	}
+	shard.missing.emplace(key);
+}
+
+std::vector<std::pair<std::string, ValueWrapper>> KVStore::takeDirty() {
+	std::vector<std::pair<std::string, ValueWrapper>> dirty;
+	for (auto &shard : shards_) {
+		std::scoped_lock lock(shard.mutex);
+		for (const auto &key : shard.dirtyKeys) {
+			auto it = shard.entries.find(key);
+			// Evicted, and saved, or listed twice
+			if (it == shard.entries.end() || !it->second.dirty) {
+				continue;
+			}
+
+			auto &entry = it->second;
+			entry.dirty = false;
+			entry.saving = true;
+			dirty.emplace_back(key, entry.value);
+		}
+		shard.dirtyKeys.clear();
+	}
+	return dirty;
+}
+
+void KVStore::finishSave(const std::vector<std::pair<std::string, ValueWrapper>> &entries) {
+	for (const auto &[key, value] : entries) {
+		auto &shard = getShard(key);
+		std::scoped_lock lock(shard.mutex);
+		if (auto it = shard.entries.find(key); it != shard.entries.end()) {
+			it->second.saving = false;
+		} else {
+			shard.evictedWhileSaving.erase(key);
+		}
+	}
+}
+
+void KVStore::restoreDirty(const std::vector<std::pair<std::string, ValueWrapper>> &entries) {
+	for (const auto &[key, value] : entries) {
+		auto &shard = getShard(key);
+		std::scoped_lock lock(shard.mutex);
+		auto it = shard.entries.find(key);
+		if (it != shard.entries.end()) {
+			auto &entry = it->second;
+			entry.saving = false;
+			// Otherwise it holds a newer value, already listed to be saved
+			if (!entry.dirty) {
+				entry.dirty = true;
+				shard.dirtyKeys.emplace_back(key);
+			}
+		} else if (!shard.evictedWhileSaving.erase(key)) {
+			// Evicted without being saved, the failed value is still the latest one
+			setLocked(shard, key, value, true);
+		}
+	}
+}
+
+bool KVStore::saveAll() {
+	auto dirty = takeDirty();
+	std::vector<std::pair<std::string, ValueWrapper>> saved;
+	std::vector<std::pair<std::string, ValueWrapper>> failed;
+	for (auto &[key, value] : dirty) {
+		if (save(key, value)) {
+			saved.emplace_back(std::move(key), std::move(value));
+		} else {
+			failed.emplace_back(std::move(key), std::move(value));
+		}
+	}
+
+	finishSave(saved);
+	if (!failed.empty()) {
+		restoreDirty(failed);
+		return false;
+	}
+	return true;
+}
+
+void KVStore::flush() {
+	KV::flush();
+	for (auto &shard : shards_) {
+		std::scoped_lock lock(shard.mutex);
+		shard.entries.clear();
+		shard.clock.clear();
+		shard.hand = 0;
+		shard.missing.clear();
+		shard.dirtyKeys.clear();
+		shard.evictedWhileSaving.clear();
+		shard.index.clear();
+	}
+
+	std::scoped_lock lock(scopesMutex_);
+	prefetchedScopes_.clear();
+	evictions_ = 0;
+}
+
+std::set<std::string> KVStore::keys(const std::string &prefix /*= ""*/) {
+	logger.trace("KVStore::keys({})", prefix);
+	std::set<std::string> keys;
+	std::optional<std::vector<std::string>> backendKeys;
+	// A full store would evict other scopes to make room, and likely part of this one
+	if (prefix.ends_with('.') && !isPrefetched(prefix) && evictions_.load() == 0) {
+		std::vector<std::pair<std::string, ValueWrapper>> values;
+		if (!prefetch(prefix.substr(0, prefix.size() - 1), values)) {
+			// Not kept, but the keys were just loaded, no need to ask the backend again
+			auto &loaded = backendKeys.emplace();
+			loaded.reserve(values.size());
+			for (const auto &[key, value] : values) {
+				loaded.emplace_back(key.substr(prefix.size()));
+			}
+		}
+	}
+
+	// Not complete in memory, the backend may have keys that were never loaded
+	if (!isPrefetched(prefix)) {
+		auto suffixes = backendKeys ? std::move(*backendKeys) : loadPrefix(prefix);
+		for (auto &suffix : suffixes) {
+			const auto key = prefix + suffix;
+			auto &shard = getShard(key);
+			std::scoped_lock lock(shard.mutex);
+			// Skips keys removed in memory and not saved yet
+			auto it = shard.entries.find(key);
+			if (it == shard.entries.end() || !it->second.value.isDeleted()) {
+				keys.emplace(std::move(suffix));
+			}
+		}
+	}
+
+	// Every shard holds part of the scope, the set merges them back in order
+	for (auto &shard : shards_) {
+		std::scoped_lock lock(shard.mutex);
+		for (auto it = shard.index.lower_bound(prefix); it != shard.index.end() && it->starts_with(prefix); ++it) {
+			keys.emplace(it->substr(prefix.size()));
+		}
 	}
 	return keys;
 }
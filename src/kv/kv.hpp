@@ -15,9 +15,11 @@
 	#include <initializer_list>
 	#include <parallel_hashmap/phmap.h>
 	#include <optional>
-	#include <unordered_set>
+	#include <set>
 	#include <iomanip>
-	#include <list>
+	#include <array>
+	#include <atomic>
+	#include <vector>
 #endif
 
 #include "lib/logging/logger.hpp"
@@ -37,7 +39,12 @@ public:
 
 	virtual std::shared_ptr<KV> scoped(const std::string &scope) = 0;
 
-	virtual std::unordered_set<std::string> keys(const std::string &prefix = "") = 0;
+	/**
+	 * @brief Lists the keys starting with the prefix, without it.
+	 *
+	 * @return The keys in lexicographic order
+	 */
+	virtual std::set<std::string> keys(const std::string &prefix = "") = 0;
 
 	void remove(const std::string &key);
 
@@ -74,6 +81,9 @@ private:
 class KVStore : public KV {
 public:
 	static constexpr size_t MAX_SIZE = 1000000;
+	// Keys are spread over independently locked shards, so the dispatcher and the thread pool rarely contend
+	static constexpr size_t SHARD_COUNT = 16;
+	static constexpr size_t SHARD_SIZE = MAX_SIZE / SHARD_COUNT;
 	static KVStore &getInstance();
 
 	explicit KVStore(Logger &logger) :
@@ -85,24 +95,46 @@ public:
 
 	std::optional<ValueWrapper> get(const std::string &key, bool forceLoad = false) override;
 
-	void flush() override {
-		std::scoped_lock lock(mutex_);
-		KV::flush();
-		store_.clear();
-	}
+	/**
+	 * @brief Loads every key of a scope (e.g. "player.123") with a single backend query.
+	 *
+	 * Meant to run off the dispatcher, e.g. while a player logs in. Afterwards, keys of
+	 * the scope that are not in memory are known not to exist, so their lookups don't
+	 * reach the backend either. Values changed in memory meanwhile are kept.
+	 */
+	void prefetch(const std::string &scope);
+
+	/**
+	 * @brief Saves the entries changed since the last save, one key at a time.
+	 *
+	 * Backends able to write in bulk should override it using takeDirty().
+	 */
+	bool saveAll() override;
+	void flush() override;
 
 	std::shared_ptr<KV> scoped(const std::string &scope) override final;
-	std::unordered_set<std::string> keys(const std::string &prefix = "");
+	/**
+	 * @brief Lists the keys starting with the prefix, without it.
+	 *
+	 * While the store hasn't had to evict anything, a whole scope (a prefix ending with '.')
+	 * is prefetched the first time it is listed, so listing it again, and reading its
+	 * values, is served from memory.
+	 */
+	std::set<std::string> keys(const std::string &prefix = "") override;
 
 protected:
-	phmap::parallel_flat_hash_map<std::string, std::pair<ValueWrapper, std::list<std::string>::iterator>> getStore() {
-		std::scoped_lock lock(mutex_);
-		phmap::parallel_flat_hash_map<std::string, std::pair<ValueWrapper, std::list<std::string>::iterator>> copy;
-		for (const auto &[key, value] : store_) {
-			copy.try_emplace(key, value);
-		}
-		return copy;
-	}
+	/**
+	 * @brief Returns the entries changed since the last save and marks them as being saved.
+	 *
+	 * Each shard keeps the list of its changed keys, so the unchanged entries aren't visited.
+	 * Entries being saved are not evicted until the caller reports the outcome with
+	 * finishSave() or restoreDirty().
+	 */
+	std::vector<std::pair<std::string, ValueWrapper>> takeDirty();
+	// Reports entries returned by takeDirty() as saved
+	void finishSave(const std::vector<std::pair<std::string, ValueWrapper>> &entries);
+	// Reports entries returned by takeDirty() as failed to save, they are dirty again
+	void restoreDirty(const std::vector<std::pair<std::string, ValueWrapper>> &entries);
 
 protected:
 	Logger &logger;
@@ -110,13 +142,63 @@ protected:
 	virtual std::optional<ValueWrapper> load(const std::string &key) = 0;
 	virtual bool save(const std::string &key, const ValueWrapper &value) = 0;
 	virtual std::vector<std::string> loadPrefix(const std::string &prefix = "") = 0;
+	// Loads the full keys and values under "scope.", backends should override it with a single query
+	virtual std::vector<std::pair<std::string, ValueWrapper>> loadScope(const std::string &scope);
 
 private:
-	void setLocked(const std::string &key, const ValueWrapper &value);
-
-	phmap::parallel_flat_hash_map<std::string, std::pair<ValueWrapper, std::list<std::string>::iterator>> store_;
-	std::list<std::string> lruQueue_;
-	std::mutex mutex_;
+	struct Entry {
+		ValueWrapper value;
+		// Changed since the last save
+		bool dirty = false;
+		// Handed to a save that hasn't finished yet
+		bool saving = false;
+		// Used since the clock hand last passed by
+		bool referenced = true;
+	};
+
+	struct Shard {
+		std::mutex mutex;
+		phmap::flat_hash_map<std::string, Entry> entries;
+		// CLOCK replacement: the hand gives referenced entries a second chance and evicts the first one that isn't
+		std::vector<std::string> clock;
+		size_t hand = 0;
+		// Negative cache, keys the backend doesn't have
+		phmap::flat_hash_set<std::string> missing;
+		// Keys that became dirty since the last takeDirty(), may include keys evicted since
+		std::vector<std::string> dirtyKeys;
+		// Keys evicted during their save with a newer value, which eviction saved already
+		phmap::flat_hash_set<std::string> evictedWhileSaving;
+		// Ordered keys of the shard with a live value in memory, to list scopes without scanning the entries
+		std::set<std::string, std::less<>> index;
+	};
+
+	Shard &getShard(const std::string &key);
+
+	void setLocked(Shard &shard, const std::string &key, const ValueWrapper &value, bool dirty);
+	// Evicts an entry of a full shard and returns its clock slot, to be reused
+	size_t evictLocked(Shard &shard);
+	// Marks the prefetched scopes covering an evicted key as no longer complete in memory
+	void invalidateScopes(std::string_view key);
+	// Returns whether the scope is now complete in memory, the loaded values are left in values
+	bool prefetch(const std::string &scope, std::vector<std::pair<std::string, ValueWrapper>> &values);
+	// Returns true if the key is answered from memory, either with a value or as known missing
+	bool getCachedLocked(Shard &shard, const std::string &key, std::optional<ValueWrapper> &value);
+	bool isKnownMissingLocked(const Shard &shard, const std::string &key);
+	void setMissingLocked(Shard &shard, const std::string &key);
+	// Whether a parent scope of the key was prefetched, "a.b.c" is covered by "a" and "a.b"
+	bool isPrefetched(std::string_view key);
+	void updateIndexLocked(Shard &shard, const std::string &key, bool indexed);
+
+	std::array<Shard, SHARD_COUNT> shards_;
+
+	// Scopes fully loaded by prefetch, any key of them not in memory doesn't exist
+	// Locked after a shard mutex, never before
+	std::mutex scopesMutex_;
+	phmap::flat_hash_set<std::string> prefetchedScopes_;
+	// Scopes being prefetched, and whether a key of them was evicted meanwhile
+	phmap::flat_hash_map<std::string, bool> prefetchingScopes_;
+	// Evictions since the last flush, none means the store still has room to keep a whole scope
+	std::atomic<uint64_t> evictions_ = 0;
 };
 
 class ScopedKV final : public KV {
@@ -156,7 +238,7 @@ public:
 		return std::make_shared<ScopedKV>(logger, rootKV_, buildKey(scope));
 	}
 
-	std::unordered_set<std::string> keys(const std::string &prefix = "") override {
+	std::set<std::string> keys(const std::string &prefix = "") override {
 		return rootKV_.keys(buildKey(prefix));
 	}
 
@@ -0,0 +1,155 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "kv/kv_log.hpp"
+
+#include "database/database.hpp"
+#include "lib/logging/logger.hpp"
+#include "kv/value_wrapper_proto.hpp"
+
+#include <kv.pb.h>
+
+KVLog::KVLog(Database &db, Logger &logger) :
+	KVStore(logger), db(db) { }
+
+KVLogFile &KVLog::file() {
+	std::call_once(openFlag, [this] {
+		const auto path = std::filesystem::current_path() / "kv" / "kv.log";
+		if (!std::filesystem::exists(path) && !importFromDatabase(path)) {
+			logger.error("[KVLog] - Cannot import the kv_store table into {}, key-value data won't be loaded nor saved", path.string());
+			return;
+		}
+
+		if (!logFile.open(path)) {
+			logger.error("[KVLog] - Cannot open {}, key-value data won't be loaded nor saved", path.string());
+		}
+	});
+	return logFile;
+}
+
+bool KVLog::importFromDatabase(const std::filesystem::path &path) {
+	// Imported into a temporary file that only takes the real name once complete,
+	// an import interrupted by a crash or a failed write is redone on the next start
+	auto tempPath = path;
+	tempPath += ".import";
+	std::error_code error;
+	std::filesystem::remove(tempPath, error);
+
+	Benchmark bm_import;
+	size_t imported = 0;
+	bool success = logFile.open(tempPath);
+	if (success) {
+		if (auto result = db.storeQuery("SELECT `key_name`, `timestamp`, `value` FROM `kv_store`")) {
+			do {
+				unsigned long size;
+				auto data = result->getStream("value", size);
+				if (data == nullptr) {
+					continue;
+				}
+
+				if (!logFile.put(result->getString("key_name"), std::string_view(data, size), result->getNumber<uint64_t>("timestamp"))) {
+					success = false;
+					break;
+				}
+				++imported;
+			} while (result->next());
+		}
+		success = logFile.sync() && success;
+	}
+	logFile.close();
+
+	if (success) {
+		std::filesystem::rename(tempPath, path, error);
+		success = !error;
+	}
+	if (!success) {
+		std::filesystem::remove(tempPath, error);
+		return false;
+	}
+
+	logger.info("[KVLog] - Imported {} keys from the database in {} milliseconds", imported, bm_import.duration());
+	return true;
+}
+
+std::optional<ValueWrapper> KVLog::load(const std::string &key) {
+	auto value = file().get(key);
+	if (!value) {
+		return std::nullopt;
+	}
+	return parseValue(key, *value);
+}
+
+std::vector<std::pair<std::string, ValueWrapper>> KVLog::loadScope(const std::string &scope) {
+	std::vector<std::pair<std::string, ValueWrapper>> values;
+	for (auto &[key, value] : file().scan(scope + ".")) {
+		if (auto parsed = parseValue(key, value)) {
+			values.emplace_back(std::move(key), std::move(*parsed));
+		}
+	}
+	return values;
+}
+
+std::vector<std::string> KVLog::loadPrefix(const std::string &prefix /* = ""*/) {
+	auto keys = file().keys(prefix);
+	for (auto &key : keys) {
+		key.erase(0, prefix.size());
+	}
+	return keys;
+}
+
+std::optional<ValueWrapper> KVLog::parseValue(const std::string &key, const KVLogFile::Value &value) const {
+	Canary::protobuf::kv::ValueWrapper protoValue;
+	if (protoValue.ParseFromString(value.data)) {
+		return ProtoSerializable::fromProto(protoValue, value.timestamp);
+	}
+	logger.error("Failed to deserialize value for key {}", key);
+	return std::nullopt;
+}
+
+bool KVLog::save(const std::string &key, const ValueWrapper &value) {
+	if (value.isDeleted()) {
+		return file().erase(key);
+	}
+
+	auto protoValue = ProtoSerializable::toProto(value);
+	std::string data;
+	if (!protoValue.SerializeToString(&data)) {
+		return false;
+	}
+	return file().put(key, data, value.getTimestamp());
+}
+
+bool KVLog::saveAll() {
+	auto dirty = takeDirty();
+	if (dirty.empty()) {
+		return true;
+	}
+
+	// Appended one by one, synced to disk once
+	bool success = std::ranges::all_of(dirty, [this](const auto &kv) {
+		const auto &[key, value] = kv;
+		return save(key, value);
+	});
+	success = file().sync() && success;
+
+	if (!success) {
+		logger.error("[{}] Error occurred saving key-value data", __FUNCTION__);
+		restoreDirty(dirty);
+		return false;
+	}
+	finishSave(dirty);
+
+	if (file().needsCompaction()) {
+		Benchmark bm_compact;
+		if (file().compact()) {
+			logger.info("[KVLog] - Compacted key-value file in {} milliseconds", bm_compact.duration());
+		}
+	}
+	return true;
+}
@@ -0,0 +1,55 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "kv/kv.hpp"
+#include "kv/kv_log_file.hpp"
+
+class Database;
+class Logger;
+class ValueWrapper;
+
+/**
+ * @brief KVStore backend keeping the values in a local append-only file (kv/kv.log) instead of the database.
+ *
+ * Enabled with the FEATURE_KV_LOG build option. The file is opened on first use;
+ * if it doesn't exist yet, the contents of the kv_store table are imported into it.
+ *
+ * saveAll() appends the changed entries and syncs the file once, then compacts it
+ * if most of it is garbage. The compaction copies the live records without holding
+ * the file lock, so loads from the dispatcher only wait for the final swap.
+ */
+class KVLog final : public KVStore {
+public:
+	explicit KVLog(Database &db, Logger &logger);
+
+	bool saveAll() override;
+
+	/**
+	 * @brief Copies every row of the kv_store table into a new file at path.
+	 *
+	 * @return false if the import didn't complete, path isn't created then
+	 */
+	bool importFromDatabase(const std::filesystem::path &path);
+
+private:
+	std::vector<std::string> loadPrefix(const std::string &prefix = "") override;
+	std::vector<std::pair<std::string, ValueWrapper>> loadScope(const std::string &scope) override;
+	std::optional<ValueWrapper> load(const std::string &key) override;
+	bool save(const std::string &key, const ValueWrapper &value) override;
+
+	std::optional<ValueWrapper> parseValue(const std::string &key, const KVLogFile::Value &value) const;
+	// Opens the file the first time it is needed, the database is connected by then
+	KVLogFile &file();
+
+	Database &db;
+	KVLogFile logFile;
+	std::once_flag openFlag;
+};
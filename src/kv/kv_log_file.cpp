@@ -0,0 +1,415 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "kv/kv_log_file.hpp"
+
+#ifdef _WIN32
+	#include <io.h>
+#else
+	#include <unistd.h>
+#endif
+
+namespace {
+	// Record layout: checksum, key size, value size, timestamp, key, value
+	// The checksum covers everything after itself
+	constexpr size_t HEADER_SIZE = sizeof(uint32_t) * 3 + sizeof(uint64_t);
+	constexpr uint32_t TOMBSTONE = std::numeric_limits<uint32_t>::max();
+
+	uint32_t checksum(const char* data, size_t size) {
+		// FNV-1a, stable across builds unlike std::hash
+		uint32_t hash = 2166136261u;
+		for (size_t i = 0; i < size; ++i) {
+			hash ^= static_cast<uint8_t>(data[i]);
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	std::string encodeRecord(const std::string &key, std::string_view data, uint64_t timestamp, bool tombstone) {
+		const auto keySize = static_cast<uint32_t>(key.size());
+		const uint32_t valueSize = tombstone ? TOMBSTONE : static_cast<uint32_t>(data.size());
+
+		std::string record(HEADER_SIZE, '\0');
+		std::memcpy(record.data() + 4, &keySize, sizeof(keySize));
+		std::memcpy(record.data() + 8, &valueSize, sizeof(valueSize));
+		std::memcpy(record.data() + 12, &timestamp, sizeof(timestamp));
+		record.append(key);
+		if (!tombstone) {
+			record.append(data);
+		}
+
+		const uint32_t sum = checksum(record.data() + 4, record.size() - 4);
+		std::memcpy(record.data(), &sum, sizeof(sum));
+		return record;
+	}
+
+	bool syncFile(std::FILE* file) {
+		if (std::fflush(file) != 0) {
+			return false;
+		}
+#ifdef _WIN32
+		return _commit(_fileno(file)) == 0;
+#else
+		return fsync(fileno(file)) == 0;
+#endif
+	}
+}
+
+KVLogFile::~KVLogFile() {
+	close();
+}
+
+bool KVLogFile::open(const std::filesystem::path &filePath) {
+	std::scoped_lock lock(mutex);
+	return openLocked(filePath);
+}
+
+void KVLogFile::close() {
+	std::scoped_lock lock(mutex);
+	closeLocked();
+}
+
+bool KVLogFile::isOpen() const {
+	return writer != nullptr;
+}
+
+bool KVLogFile::openLocked(const std::filesystem::path &filePath) {
+	closeLocked();
+	path = filePath;
+
+	std::error_code error;
+	if (path.has_parent_path()) {
+		std::filesystem::create_directories(path.parent_path(), error);
+		if (error) {
+			g_logger().error("[{}] - Cannot create folder {}: {}", __FUNCTION__, path.parent_path().string(), error.message());
+			return false;
+		}
+	}
+
+	if (!rebuildIndexLocked()) {
+		return false;
+	}
+
+	writer = std::fopen(path.string().c_str(), "ab");
+	if (!writer) {
+		g_logger().error("[{}] - Cannot open {} for writing", __FUNCTION__, path.string());
+		return false;
+	}
+
+	reader.open(path, std::ios::binary);
+	if (!reader) {
+		g_logger().error("[{}] - Cannot open {} for reading", __FUNCTION__, path.string());
+		closeLocked();
+		return false;
+	}
+	return true;
+}
+
+void KVLogFile::closeLocked() {
+	if (writer) {
+		syncFile(writer);
+		std::fclose(writer);
+		writer = nullptr;
+	}
+	if (reader.is_open()) {
+		reader.close();
+	}
+	index.clear();
+	fileSize = 0;
+	liveSize = 0;
+	unflushed = false;
+}
+
+bool KVLogFile::rebuildIndexLocked() {
+	std::error_code error;
+	const auto size = std::filesystem::exists(path, error) ? std::filesystem::file_size(path, error) : 0;
+	if (error || size == 0) {
+		return !error;
+	}
+
+	uint64_t offset = 0;
+	try {
+		const mio::mmap_source source(path.string());
+		const char* data = source.data();
+		while (offset + HEADER_SIZE <= size) {
+			uint32_t sum, keySize, valueSize;
+			uint64_t timestamp;
+			std::memcpy(&sum, data + offset, sizeof(sum));
+			std::memcpy(&keySize, data + offset + 4, sizeof(keySize));
+			std::memcpy(&valueSize, data + offset + 8, sizeof(valueSize));
+			std::memcpy(&timestamp, data + offset + 12, sizeof(timestamp));
+
+			const bool tombstone = valueSize == TOMBSTONE;
+			const uint64_t recordSize = HEADER_SIZE + keySize + (tombstone ? 0 : valueSize);
+			if (offset + recordSize > size || checksum(data + offset + 4, recordSize - 4) != sum) {
+				break;
+			}
+
+			std::string key(data + offset + HEADER_SIZE, keySize);
+			if (auto it = index.find(key); it != index.end()) {
+				liveSize -= HEADER_SIZE + it->first.size() + it->second.size;
+				index.erase(it);
+			}
+			if (!tombstone) {
+				index.emplace(std::move(key), Location { offset + HEADER_SIZE + keySize, valueSize, timestamp });
+				liveSize += recordSize;
+			}
+			offset += recordSize;
+		}
+	} catch (const std::system_error &e) {
+		g_logger().error("[{}] - Cannot map {}: {}", __FUNCTION__, path.string(), e.what());
+		return false;
+	}
+
+	if (offset < size) {
+		g_logger().warn("[{}] - {} has a damaged record at byte {}, discarding the last {} bytes", __FUNCTION__, path.string(), offset, size - offset);
+		std::filesystem::resize_file(path, offset, error);
+		if (error) {
+			g_logger().error("[{}] - Cannot truncate {}: {}", __FUNCTION__, path.string(), error.message());
+			return false;
+		}
+	}
+	fileSize = offset;
+	return true;
+}
+
+std::optional<KVLogFile::Value> KVLogFile::get(const std::string &key) {
+	std::scoped_lock lock(mutex);
+	auto it = index.find(key);
+	if (it == index.end()) {
+		return std::nullopt;
+	}
+
+	Value value;
+	value.timestamp = it->second.timestamp;
+	if (!readLocked(it->second, value.data)) {
+		return std::nullopt;
+	}
+	return value;
+}
+
+bool KVLogFile::put(const std::string &key, std::string_view data, uint64_t timestamp) {
+	std::scoped_lock lock(mutex);
+	return appendLocked(key, data, timestamp, false);
+}
+
+bool KVLogFile::erase(const std::string &key) {
+	std::scoped_lock lock(mutex);
+	if (!index.contains(key)) {
+		return true;
+	}
+	return appendLocked(key, {}, 0, true);
+}
+
+std::vector<std::string> KVLogFile::keys(std::string_view prefix) {
+	std::scoped_lock lock(mutex);
+	std::vector<std::string> keys;
+	for (auto it = index.lower_bound(prefix); it != index.end() && it->first.starts_with(prefix); ++it) {
+		keys.emplace_back(it->first);
+	}
+	return keys;
+}
+
+std::vector<std::pair<std::string, KVLogFile::Value>> KVLogFile::scan(std::string_view prefix) {
+	std::scoped_lock lock(mutex);
+	std::vector<std::pair<std::string, Value>> values;
+	for (auto it = index.lower_bound(prefix); it != index.end() && it->first.starts_with(prefix); ++it) {
+		Value value;
+		value.timestamp = it->second.timestamp;
+		if (readLocked(it->second, value.data)) {
+			values.emplace_back(it->first, std::move(value));
+		}
+	}
+	return values;
+}
+
+size_t KVLogFile::size() {
+	std::scoped_lock lock(mutex);
+	return index.size();
+}
+
+bool KVLogFile::sync() {
+	std::scoped_lock lock(mutex);
+	if (!writer) {
+		return false;
+	}
+	unflushed = false;
+	return syncFile(writer);
+}
+
+bool KVLogFile::needsCompaction() {
+	std::scoped_lock lock(mutex);
+	return fileSize >= MIN_COMPACTION_SIZE && liveSize * 2 < fileSize;
+}
+
+bool KVLogFile::compact() {
+	// One compaction at a time; reads and writes keep going while the live records are copied
+	std::scoped_lock compactLock(compactMutex);
+
+	std::map<std::string, Location, std::less<>> snapshot;
+	std::filesystem::path filePath;
+	uint64_t snapshotSize;
+	{
+		std::scoped_lock lock(mutex);
+		if (!writer || (unflushed && !flushLocked())) {
+			return false;
+		}
+		// Records before snapshotSize never change, the file is only appended to
+		snapshot = index;
+		filePath = path;
+		snapshotSize = fileSize;
+	}
+
+	auto tempPath = filePath;
+	tempPath += ".compact";
+	std::FILE* output = std::fopen(tempPath.string().c_str(), "wb");
+	std::ifstream input(filePath, std::ios::binary);
+	if (!output || !input) {
+		g_logger().error("[{}] - Cannot create {}", __FUNCTION__, tempPath.string());
+		if (output) {
+			std::fclose(output);
+		}
+		return false;
+	}
+
+	phmap::flat_hash_map<std::string, uint64_t> newOffsets;
+	newOffsets.reserve(snapshot.size());
+	uint64_t newSize = 0;
+	bool success = true;
+	std::string data;
+	for (const auto &[key, location] : snapshot) {
+		data.resize(location.size);
+		input.seekg(static_cast<std::streamoff>(location.offset));
+		if (!input.read(data.data(), location.size)) {
+			success = false;
+			break;
+		}
+
+		const auto record = encodeRecord(key, data, location.timestamp, false);
+		if (std::fwrite(record.data(), 1, record.size(), output) != record.size()) {
+			success = false;
+			break;
+		}
+		newOffsets.emplace(key, newSize + HEADER_SIZE + key.size());
+		newSize += record.size();
+	}
+
+	std::scoped_lock lock(mutex);
+	std::error_code error;
+	if (!success || !writer || path != filePath) {
+		g_logger().error("[{}] - Cannot write {}", __FUNCTION__, tempPath.string());
+		std::fclose(output);
+		std::filesystem::remove(tempPath, error);
+		return false;
+	}
+
+	// Records appended while copying are already encoded, they go after the live ones as they are
+	const uint64_t tailSize = fileSize - snapshotSize;
+	if (tailSize > 0) {
+		success = readLocked(Location { snapshotSize, static_cast<uint32_t>(tailSize), 0 }, data)
+			&& std::fwrite(data.data(), 1, data.size(), output) == data.size();
+	}
+
+	success = syncFile(output) && success;
+	std::fclose(output);
+	if (!success) {
+		g_logger().error("[{}] - Cannot write {}", __FUNCTION__, tempPath.string());
+		std::filesystem::remove(tempPath, error);
+		return false;
+	}
+
+	std::fclose(writer);
+	writer = nullptr;
+	reader.close();
+	std::filesystem::rename(tempPath, path, error);
+	if (error) {
+		g_logger().error("[{}] - Cannot replace {}: {}", __FUNCTION__, path.string(), error.message());
+		std::filesystem::remove(tempPath, error);
+	}
+
+	// Still the old file if the rename failed, its index stays valid
+	const bool replaced = !error;
+	writer = std::fopen(path.string().c_str(), "ab");
+	reader.open(path, std::ios::binary);
+	if (!writer || !reader) {
+		g_logger().error("[{}] - Cannot reopen {}", __FUNCTION__, path.string());
+		closeLocked();
+		return false;
+	}
+	if (!replaced) {
+		return false;
+	}
+
+	liveSize = 0;
+	for (auto &[key, location] : index) {
+		if (location.offset >= snapshotSize) {
+			location.offset = location.offset - snapshotSize + newSize;
+		} else {
+			// Not written since the snapshot, so it was copied
+			location.offset = newOffsets.at(key);
+		}
+		liveSize += HEADER_SIZE + key.size() + location.size;
+	}
+	fileSize = newSize + tailSize;
+	return true;
+}
+
+bool KVLogFile::appendLocked(const std::string &key, std::string_view data, uint64_t timestamp, bool tombstone) {
+	if (!writer) {
+		return false;
+	}
+
+	const auto record = encodeRecord(key, data, timestamp, tombstone);
+	if (std::fwrite(record.data(), 1, record.size(), writer) != record.size()) {
+		g_logger().error("[{}] - Cannot write to {}", __FUNCTION__, path.string());
+		return false;
+	}
+
+	const uint64_t offset = fileSize;
+	fileSize += record.size();
+	unflushed = true;
+
+	if (auto it = index.find(key); it != index.end()) {
+		liveSize -= HEADER_SIZE + it->first.size() + it->second.size;
+		if (tombstone) {
+			index.erase(it);
+			return true;
+		}
+		it->second = Location { offset + HEADER_SIZE + key.size(), static_cast<uint32_t>(data.size()), timestamp };
+	} else if (!tombstone) {
+		index.emplace(key, Location { offset + HEADER_SIZE + key.size(), static_cast<uint32_t>(data.size()), timestamp });
+	}
+	liveSize += record.size();
+	return true;
+}
+
+bool KVLogFile::readLocked(const Location &location, std::string &data) {
+	if (unflushed && !flushLocked()) {
+		return false;
+	}
+
+	data.resize(location.size);
+	// The reader may have hit the end of the file before it grew
+	reader.clear();
+	reader.seekg(static_cast<std::streamoff>(location.offset));
+	reader.read(data.data(), location.size);
+	if (!reader) {
+		g_logger().error("[{}] - Cannot read {} bytes at {} from {}", __FUNCTION__, location.size, location.offset, path.string());
+		return false;
+	}
+	return true;
+}
+
+bool KVLogFile::flushLocked() {
+	if (std::fflush(writer) != 0) {
+		return false;
+	}
+	unflushed = false;
+	return true;
+}
@@ -0,0 +1,98 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * @brief Append-only file of key/value records, with an ordered index of the latest record of each key kept in memory.
+ *
+ * Every write appends a record, overwritten and removed keys leave garbage behind
+ * that compact() drops by rewriting the live records into a new file. Opening maps
+ * the file in memory and scans it once to rebuild the index; a record left partially
+ * written by a crash fails its checksum and is cut off, along with anything after it.
+ *
+ * Writes are buffered, sync() flushes them to disk so callers can batch them.
+ * All methods are thread-safe.
+ */
+class KVLogFile {
+public:
+	struct Value {
+		std::string data;
+		uint64_t timestamp = 0;
+	};
+
+	// Compaction only pays off once there is a reasonable amount of garbage
+	static constexpr uint64_t MIN_COMPACTION_SIZE = 16 * 1024 * 1024;
+
+	KVLogFile() = default;
+	~KVLogFile();
+
+	// non-copyable
+	KVLogFile(const KVLogFile &) = delete;
+	KVLogFile &operator=(const KVLogFile &) = delete;
+
+	/**
+	 * @brief Opens the file, creating it and its folder if needed, and rebuilds the index.
+	 */
+	bool open(const std::filesystem::path &path);
+	void close();
+	bool isOpen() const;
+
+	std::optional<Value> get(const std::string &key);
+	bool put(const std::string &key, std::string_view data, uint64_t timestamp);
+	bool erase(const std::string &key);
+
+	// Keys starting with the prefix, in lexicographic order
+	std::vector<std::string> keys(std::string_view prefix);
+	// Keys starting with the prefix and their values, in lexicographic order
+	std::vector<std::pair<std::string, Value>> scan(std::string_view prefix);
+	size_t size();
+
+	/**
+	 * @brief Flushes the buffered writes and waits until they reach the disk.
+	 */
+	bool sync();
+
+	// Whether most of the file is garbage, see MIN_COMPACTION_SIZE
+	bool needsCompaction();
+
+	/**
+	 * @brief Rewrites the live records into a new file, which then replaces the current one.
+	 *
+	 * The live records are copied from a snapshot of the index without holding the lock, so
+	 * reads and writes go on meanwhile. The lock is only taken again to append the records
+	 * written since the snapshot and swap the files. On failure the current file is kept untouched.
+	 */
+	bool compact();
+
+private:
+	struct Location {
+		uint64_t offset = 0;
+		uint32_t size = 0;
+		uint64_t timestamp = 0;
+	};
+
+	bool openLocked(const std::filesystem::path &path);
+	void closeLocked();
+	bool rebuildIndexLocked();
+	bool appendLocked(const std::string &key, std::string_view data, uint64_t timestamp, bool tombstone);
+	bool readLocked(const Location &location, std::string &data);
+	bool flushLocked();
+
+	std::mutex mutex;
+	std::mutex compactMutex;
+	std::filesystem::path path;
+	std::FILE* writer = nullptr;
+	std::ifstream reader;
+	std::map<std::string, Location, std::less<>> index;
+	uint64_t fileSize = 0;
+	uint64_t liveSize = 0;
+	// Appended records still in the writer buffer, not visible to the reader yet
+	bool unflushed = false;
+};
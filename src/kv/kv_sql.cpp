@@ -26,6 +26,28 @@ std::optional<ValueWrapper> KVSQL::load(const std::string &key) {
 		return std::nullopt;
 	}
 
+	return parseValue(key, result);
+}
+
+std::vector<std::pair<std::string, ValueWrapper>> KVSQL::loadScope(const std::string &scope) {
+	std::vector<std::pair<std::string, ValueWrapper>> values;
+	auto query = fmt::format("SELECT `key_name`, `timestamp`, `value` FROM `kv_store` WHERE `key_name` LIKE {}", db.escapeString(scope + ".%"));
+	auto result = db.storeQuery(query);
+	if (result == nullptr) {
+		return values;
+	}
+
+	do {
+		auto key = result->getString("key_name");
+		if (auto value = parseValue(key, result)) {
+			values.emplace_back(std::move(key), std::move(*value));
+		}
+	} while (result->next());
+
+	return values;
+}
+
+std::optional<ValueWrapper> KVSQL::parseValue(const std::string &key, const std::shared_ptr<DBResult> &result) const {
 	unsigned long size;
 	auto data = result->getStream("value", size);
 	if (data == nullptr) {
@@ -83,12 +105,17 @@ bool KVSQL::prepareSave(const std::string &key, const ValueWrapper &value, DBIns
 }
 
 bool KVSQL::saveAll() {
-	auto store = getStore();
-	bool success = DBTransaction::executeWithinTransaction([this, &store]() {
+	// Only what changed since the last save, unchanged entries are already in the database
+	auto dirty = takeDirty();
+	if (dirty.empty()) {
+		return true;
+	}
+
+	bool success = DBTransaction::executeWithinTransaction([this, &dirty]() {
 		auto update = dbUpdate();
-		if (!std::ranges::all_of(store, [this, &update](const auto &kv) {
+		if (!std::ranges::all_of(dirty, [this, &update](const auto &kv) {
 				const auto &[key, value] = kv;
-				return prepareSave(key, value.first, update);
+				return prepareSave(key, value, update);
 			})) {
 			return false;
 		}
@@ -97,6 +124,9 @@ bool KVSQL::saveAll() {
 
 	if (!success) {
 		g_logger().error("[{}] Error occurred saving player", __FUNCTION__);
+		restoreDirty(dirty);
+	} else {
+		finishSave(dirty);
 	}
 
 	return success;
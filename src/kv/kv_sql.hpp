@@ -12,6 +12,7 @@
 #include "kv/kv.hpp"
 
 class Database;
+class DBResult;
 class Logger;
 class DBInsert;
 class ValueWrapper;
@@ -24,7 +25,9 @@ public:
 
 private:
 	std::vector<std::string> loadPrefix(const std::string &prefix = "") override;
+	std::vector<std::pair<std::string, ValueWrapper>> loadScope(const std::string &scope) override;
 	std::optional<ValueWrapper> load(const std::string &key) override;
+	std::optional<ValueWrapper> parseValue(const std::string &key, const std::shared_ptr<DBResult> &result) const;
 	bool save(const std::string &key, const ValueWrapper &value) override;
 	bool prepareSave(const std::string &key, const ValueWrapper &value, DBInsert &update);
 
@@ -12,6 +12,7 @@
 #include "lib/di/injector.hpp"
 #include "lib/logging/log_with_spd_log.hpp"
 #include "kv/kv_sql.hpp"
+#include "kv/kv_log.hpp"
 
 namespace di = boost::di;
 
@@ -20,7 +21,11 @@ private:
 	inline static di::extension::injector<>* testContainer;
 	const inline static auto defaultContainer = di::make_injector(
 		di::bind<AccountRepository>().to<AccountRepositoryDB>().in(di::singleton),
+#ifdef FEATURE_KV_LOG
+		di::bind<KVStore>().to<KVLog>().in(di::singleton),
+#else
 		di::bind<KVStore>().to<KVSQL>().in(di::singleton),
+#endif
 		di::bind<Logger>().to<LogWithSpdLog>().in(di::singleton)
 	);
 
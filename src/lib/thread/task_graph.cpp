@@ -0,0 +1,117 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "lib/thread/task_graph.hpp"
+
+void TaskGraph::add(const std::string &name, std::function<bool()> task, const std::vector<std::string> &dependencies) {
+	if (nodesByName.contains(name)) {
+		throw std::invalid_argument(fmt::format("Task '{}' was already added", name));
+	}
+
+	const size_t index = nodes.size();
+	for (const auto &dependency : dependencies) {
+		auto it = nodesByName.find(dependency);
+		if (it == nodesByName.end()) {
+			throw std::invalid_argument(fmt::format("Task '{}' depends on unknown task '{}'", name, dependency));
+		}
+		nodes[it->second].dependents.emplace_back(index);
+	}
+
+	auto &node = nodes.emplace_back();
+	node.name = name;
+	node.task = std::move(task);
+	node.dependencies = dependencies.size();
+	nodesByName.emplace(name, index);
+}
+
+std::vector<std::string> TaskGraph::run() {
+	std::vector<size_t> ready;
+	{
+		std::scoped_lock lock(mutex);
+		finished = 0;
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			auto &node = nodes[i];
+			node.pendingDependencies = node.dependencies;
+			node.failed = false;
+			node.skipped = false;
+			node.duration = 0;
+			node.error.clear();
+			if (node.pendingDependencies == 0) {
+				ready.emplace_back(i);
+			}
+		}
+	}
+
+	Benchmark bm_run;
+	for (const auto index : ready) {
+		threadPool.detach_task([this, index] { execute(index); });
+	}
+
+	{
+		std::unique_lock lock(mutex);
+		finishedSignal.wait(lock, [this] { return finished == nodes.size(); });
+	}
+
+	std::vector<std::string> failed;
+	for (const auto &node : nodes) {
+		if (node.skipped) {
+			g_logger().debug("[TaskGraph] - {} skipped, a dependency failed", node.name);
+			continue;
+		}
+
+		if (!node.error.empty()) {
+			g_logger().error("[TaskGraph] - {} threw: {}", node.name, node.error);
+		}
+		g_logger().debug("[TaskGraph] - {} finished in {} milliseconds", node.name, node.duration);
+		if (node.failed) {
+			failed.emplace_back(node.name);
+		}
+	}
+	g_logger().debug("[TaskGraph] - {} tasks finished in {} milliseconds", nodes.size(), bm_run.duration());
+	return failed;
+}
+
+void TaskGraph::execute(size_t index) {
+	auto &node = nodes[index];
+
+	bool success = false;
+	if (!node.skipped) {
+		Benchmark bm_task;
+		try {
+			success = node.task();
+		} catch (const std::exception &e) {
+			node.error = e.what();
+		}
+		node.duration = bm_task.duration();
+		node.failed = !success;
+	}
+
+	std::vector<size_t> ready;
+	{
+		std::scoped_lock lock(mutex);
+		for (const auto dependent : node.dependents) {
+			auto &dependentNode = nodes[dependent];
+			if (!success) {
+				dependentNode.skipped = true;
+			}
+			if (--dependentNode.pendingDependencies == 0) {
+				ready.emplace_back(dependent);
+			}
+		}
+
+		// Notify under the lock, run() may return and destroy the graph right after
+		if (++finished == nodes.size()) {
+			finishedSignal.notify_all();
+		}
+	}
+
+	for (const auto dependent : ready) {
+		threadPool.detach_task([this, dependent] { execute(dependent); });
+	}
+}
@@ -0,0 +1,74 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/thread/thread_pool.hpp"
+
+/**
+ * @brief Runs a set of named tasks on the thread pool, respecting their declared dependencies.
+ *
+ * A task starts as soon as all of its dependencies have finished successfully, so
+ * independent tasks run concurrently and the total time approaches the longest
+ * dependency chain. Dependencies must be added before the tasks that use them,
+ * which also rules out cycles.
+ *
+ * If a task fails (returns false or throws), every task depending on it is skipped.
+ */
+class TaskGraph {
+public:
+	explicit TaskGraph(ThreadPool &threadPool) :
+		threadPool(threadPool) { }
+
+	// non-copyable
+	TaskGraph(const TaskGraph &) = delete;
+	TaskGraph &operator=(const TaskGraph &) = delete;
+
+	/**
+	 * @brief Adds a task to the graph.
+	 *
+	 * @param name Unique task name, used for dependencies and logging
+	 * @param task Function returning whether the task succeeded
+	 * @param dependencies Names of previously added tasks that must finish first
+	 * @throws std::invalid_argument if the name is taken or a dependency is unknown
+	 */
+	void add(const std::string &name, std::function<bool()> task, const std::vector<std::string> &dependencies = {});
+
+	/**
+	 * @brief Runs every task and blocks until all of them finished or were skipped.
+	 *
+	 * The time spent by each task is logged at debug level from the calling thread.
+	 *
+	 * @return Names of the tasks that failed, in the order they were added
+	 */
+	std::vector<std::string> run();
+
+private:
+	struct Node {
+		std::string name;
+		std::function<bool()> task;
+		std::vector<size_t> dependents;
+		size_t dependencies = 0;
+		size_t pendingDependencies = 0;
+		bool failed = false;
+		bool skipped = false;
+		double duration = 0;
+		std::string error;
+	};
+
+	void execute(size_t index);
+
+	ThreadPool &threadPool;
+	std::vector<Node> nodes;
+	phmap::flat_hash_map<std::string, size_t> nodesByName;
+
+	std::mutex mutex;
+	std::condition_variable finishedSignal;
+	size_t finished = 0;
+};
@@ -37,33 +37,36 @@ bool EventsCallbacks::isCallbackRegistered(const std::shared_ptr<EventCallback>
 }
 
 void EventsCallbacks::addCallback(const std::shared_ptr<EventCallback> &callback) {
-	if (m_callbacks.find(callback->getName()) != m_callbacks.end() && !callback->skipDuplicationCheck()) {
+	auto it = m_callbacks.find(callback->getName());
+	if (it != m_callbacks.end() && !callback->skipDuplicationCheck()) {
 		g_logger().trace("Event callback already registered: {}", callback->getName());
 		return;
 	}
 
 	g_logger().trace("Registering event callback: {}", callback->getName());
 
-	m_callbacks[callback->getName()] = callback;
+	if (it != m_callbacks.end()) {
+		auto &bucket = m_callbacksByType[magic_enum::enum_integer(it->second->getType())];
+		std::erase(bucket, it->second);
+		it->second = callback;
+	} else {
+		m_callbacks.emplace(callback->getName(), callback);
+	}
+
+	m_callbacksByType[magic_enum::enum_integer(callback->getType())].emplace_back(callback);
 }
 
 std::unordered_map<std::string, std::shared_ptr<EventCallback>> EventsCallbacks::getCallbacks() const {
 	return m_callbacks;
 }
 
-std::unordered_map<std::string, std::shared_ptr<EventCallback>> EventsCallbacks::getCallbacksByType(EventCallback_t type) const {
-	std::unordered_map<std::string, std::shared_ptr<EventCallback>> eventCallbacks;
-	for (auto [name, callback] : getCallbacks()) {
-		if (callback->getType() != type) {
-			continue;
-		}
-
-		eventCallbacks[name] = callback;
-	}
-
-	return eventCallbacks;
+const std::vector<std::shared_ptr<EventCallback>> &EventsCallbacks::getCallbacksByType(EventCallback_t type) const {
+	return m_callbacksByType[magic_enum::enum_integer(type)];
 }
 
 void EventsCallbacks::clear() {
 	m_callbacks.clear();
+	for (auto &bucket : m_callbacksByType) {
+		bucket.clear();
+	}
 }
@@ -70,10 +70,20 @@ public:
 
 	/**
 	 * @brief Gets event callbacks by their type.
+	 * @details The buckets are filled at registration time, so this neither scans nor copies.
 	 * @param type The type of callbacks to retrieve.
-	 * @return Vector of pointers to EventCallback objects of the specified type.
+	 * @return Vector of pointers to EventCallback objects of the specified type, in registration order.
 	 */
-	std::unordered_map<std::string, std::shared_ptr<EventCallback>> getCallbacksByType(EventCallback_t type) const;
+	const std::vector<std::shared_ptr<EventCallback>> &getCallbacksByType(EventCallback_t type) const;
+
+	/**
+	 * @brief Checks if any callback is registered for the given type.
+	 * @param type The type of callbacks to look for.
+	 * @return True if at least one callback of this type is registered.
+	 */
+	bool hasCallbacks(EventCallback_t type) const {
+		return !getCallbacksByType(type).empty();
+	}
 
 	/**
 	 * @brief Clears all registered event callbacks.
@@ -88,7 +98,10 @@ public:
 	 */
 	template <typename CallbackFunc, typename... Args>
 	void executeCallback(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
-		for (const auto &[name, callback] : getCallbacksByType(eventType)) {
+		const auto &callbacks = getCallbacksByType(eventType);
+		// Indexed on purpose: a callback may reload scripts and clear the buckets under us
+		for (size_t i = 0; i < callbacks.size(); ++i) {
+			const auto callback = callbacks[i];
 			if (callback && callback->isLoadedCallback()) {
 				std::invoke(callbackFunc, *callback, args...);
 			}
@@ -104,7 +117,9 @@ public:
 	 */
 	template <typename CallbackFunc, typename... Args>
 	ReturnValue checkCallbackWithReturnValue(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
-		for (const auto &[name, callback] : getCallbacksByType(eventType)) {
+		const auto &callbacks = getCallbacksByType(eventType);
+		for (size_t i = 0; i < callbacks.size(); ++i) {
+			const auto callback = callbacks[i];
 			if (callback && callback->isLoadedCallback()) {
 				ReturnValue callbackResult = std::invoke(callbackFunc, *callback, args...);
 				if (callbackResult != RETURNVALUE_NOERROR) {
@@ -125,7 +140,9 @@ public:
 	template <typename CallbackFunc, typename... Args>
 	bool checkCallback(EventCallback_t eventType, CallbackFunc callbackFunc, Args &&... args) {
 		bool allCallbacksSucceeded = true;
-		for (const auto &[name, callback] : getCallbacksByType(eventType)) {
+		const auto &callbacks = getCallbacksByType(eventType);
+		for (size_t i = 0; i < callbacks.size(); ++i) {
+			const auto callback = callbacks[i];
 			if (callback && callback->isLoadedCallback()) {
 				bool callbackResult = std::invoke(callbackFunc, *callback, args...);
 				allCallbacksSucceeded &= callbackResult;
@@ -137,6 +154,8 @@ public:
 private:
 	// Container for storing registered event callbacks.
 	std::unordered_map<std::string, std::shared_ptr<EventCallback>> m_callbacks;
+	// The same callbacks, bucketed by EventCallback_t for dispatch.
+	std::array<std::vector<std::shared_ptr<EventCallback>>, magic_enum::enum_count<EventCallback_t>()> m_callbacksByType;
 };
 
 constexpr auto g_callbacks = EventsCallbacks::getInstance;
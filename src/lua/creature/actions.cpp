@@ -228,7 +228,7 @@ std::shared_ptr<Action> Actions::getAction(std::shared_ptr<Item> item) {
 		return it->second;
 	}
 
-	if (auto iteratePositions = actionPositionMap.find(item->getPosition());
+	if (auto iteratePositions = actionPositionMap.empty() ? actionPositionMap.end() : actionPositionMap.find(item->getPosition());
 	    iteratePositions != actionPositionMap.end()) {
 		if (std::shared_ptr<Tile> tile = item->getTile();
 		    tile) {
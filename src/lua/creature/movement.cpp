@@ -22,7 +22,7 @@ void MoveEvents::clear(bool isFromXML /*= false*/) {
 			for (int moveEventType = 0; moveEventType < MOVE_EVENT_LAST; ++moveEventType) {
 				auto &eventList = moveEventList.moveEvent[moveEventType];
 
-				eventList.remove_if([&](const std::shared_ptr<MoveEvent> &moveEvent) {
+				std::erase_if(eventList, [&](const std::shared_ptr<MoveEvent> &moveEvent) {
 					bool removed = moveEvent && moveEvent->isFromXML();
 					if (removed) {
 						g_logger().debug("MoveEvent with id '{}' is from XML and will be removed.", pair.first);
@@ -31,6 +31,7 @@ void MoveEvents::clear(bool isFromXML /*= false*/) {
 					return removed;
 				});
 			}
+			updateItemIdEventTypes(pair.first);
 		}
 
 		if (numRemoved > 0) {
@@ -43,6 +44,30 @@ void MoveEvents::clear(bool isFromXML /*= false*/) {
 	actionIdMap.clear();
 	itemIdMap.clear();
 	positionsMap.clear();
+	itemIdEventTypes.clear();
+}
+
+void MoveEvents::updateItemIdEventTypes(int32_t itemId) {
+	if (itemId < 0 || itemId > std::numeric_limits<uint16_t>::max()) {
+		return;
+	}
+
+	uint8_t eventTypes = 0;
+	if (auto it = itemIdMap.find(itemId); it != itemIdMap.end()) {
+		for (int moveEventType = 0; moveEventType < MOVE_EVENT_LAST; ++moveEventType) {
+			if (!it->second.moveEvent[moveEventType].empty()) {
+				eventTypes |= 1 << moveEventType;
+			}
+		}
+	}
+
+	if (static_cast<size_t>(itemId) >= itemIdEventTypes.size()) {
+		if (eventTypes == 0) {
+			return;
+		}
+		itemIdEventTypes.resize(itemId + 1);
+	}
+	itemIdEventTypes[itemId] = eventTypes;
 }
 
 bool MoveEvents::registerLuaItemEvent(const std::shared_ptr<MoveEvent> moveEvent) {
@@ -63,6 +88,7 @@ bool MoveEvents::registerLuaItemEvent(const std::shared_ptr<MoveEvent> moveEvent
 			it.vocationString = moveEvent->getVocationString();
 		}
 		if (registerEvent(moveEvent, itemId, itemIdMap)) {
+			updateItemIdEventTypes(itemId);
 			tmpVector.emplace_back(itemId);
 		}
 	}
@@ -145,7 +171,7 @@ bool MoveEvents::registerLuaEvent(const std::shared_ptr<MoveEvent> moveEvent) {
 	}
 }
 
-bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, std::map<int32_t, MoveEventList> &moveListMap) const {
+bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, MoveEventIdMap &moveListMap) const {
 	auto it = moveListMap.find(id);
 	if (it == moveListMap.end()) {
 		MoveEventList moveEventList;
@@ -153,7 +179,7 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32
 		moveListMap[id] = moveEventList;
 		return true;
 	} else {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
+		auto &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
 		for (const auto &existingMoveEvent : moveEventList) {
 			if (existingMoveEvent->getSlot() == moveEvent->getSlot()) {
 				g_logger().warn(
@@ -209,9 +235,9 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 	}
 
 	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
-		std::map<int32_t, MoveEventList>::iterator it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
+		auto it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
 		if (it != actionIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> moveEventList = it->second.moveEvent[eventType];
+			const auto &moveEventList = it->second.moveEvent[eventType];
 			for (const auto &moveEvent : moveEventList) {
 				if ((moveEvent->getSlot() & slotp) != 0) {
 					return moveEvent;
@@ -220,9 +246,13 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 		}
 	}
 
+	if (!hasItemIdEvent(item->getID(), eventType)) {
+		return nullptr;
+	}
+
 	auto it = itemIdMap.find(item->getID());
 	if (it != itemIdMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
+		const auto &moveEventList = it->second.moveEvent[eventType];
 		for (const auto &moveEvent : moveEventList) {
 			if ((moveEvent->getSlot() & slotp) != 0) {
 				return moveEvent;
@@ -233,13 +263,13 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType) {
-	std::map<int32_t, MoveEventList>::iterator it;
+	MoveEventIdMap::iterator it;
 	if (item->hasAttribute(ItemAttribute_t::UNIQUEID)) {
 		it = uniqueIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::UNIQUEID));
 		if (it != uniqueIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
+			const auto &moveEventList = it->second.moveEvent[eventType];
 			if (!moveEventList.empty()) {
-				return *moveEventList.begin();
+				return moveEventList.front();
 			}
 		}
 	}
@@ -247,24 +277,29 @@ std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Item> &ite
 	if (item->hasAttribute(ItemAttribute_t::ACTIONID)) {
 		it = actionIdMap.find(item->getAttribute<uint16_t>(ItemAttribute_t::ACTIONID));
 		if (it != actionIdMap.end()) {
-			std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
+			const auto &moveEventList = it->second.moveEvent[eventType];
 			if (!moveEventList.empty()) {
-				return *moveEventList.begin();
+				return moveEventList.front();
 			}
 		}
 	}
 
+	// Most items stepped over have no script at all, skip the lookup for them
+	if (!hasItemIdEvent(item->getID(), eventType)) {
+		return nullptr;
+	}
+
 	it = itemIdMap.find(item->getID());
 	if (it != itemIdMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
+		const auto &moveEventList = it->second.moveEvent[eventType];
 		if (!moveEventList.empty()) {
-			return *moveEventList.begin();
+			return moveEventList.front();
 		}
 	}
 	return nullptr;
 }
 
-bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, std::map<Position, MoveEventList> &moveListMap) const {
+bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, MoveEventPositionMap &moveListMap) const {
 	auto it = moveListMap.find(position);
 	if (it == moveListMap.end()) {
 		MoveEventList moveEventList;
@@ -272,7 +307,7 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const
 		moveListMap[position] = moveEventList;
 		return true;
 	} else {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
+		auto &moveEventList = it->second.moveEvent[moveEvent->getEventType()];
 		if (!moveEventList.empty()) {
 			g_logger().warn(
 				"[{}] duplicate move event found: {}, for script {}",
@@ -289,11 +324,15 @@ bool MoveEvents::registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const
 }
 
 std::shared_ptr<MoveEvent> MoveEvents::getEvent(const std::shared_ptr<Tile> &tile, MoveEvent_t eventType) {
+	if (positionsMap.empty()) {
+		return nullptr;
+	}
+
 	if (auto it = positionsMap.find(tile->getPosition());
 	    it != positionsMap.end()) {
-		std::list<std::shared_ptr<MoveEvent>> &moveEventList = it->second.moveEvent[eventType];
+		const auto &moveEventList = it->second.moveEvent[eventType];
 		if (!moveEventList.empty()) {
-			return *moveEventList.begin();
+			return moveEventList.front();
 		}
 	}
 	return nullptr;
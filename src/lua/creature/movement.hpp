@@ -18,9 +18,12 @@
 class MoveEvent;
 
 struct MoveEventList {
-	std::list<std::shared_ptr<MoveEvent>> moveEvent[MOVE_EVENT_LAST];
+	std::vector<std::shared_ptr<MoveEvent>> moveEvent[MOVE_EVENT_LAST];
 };
 
+using MoveEventIdMap = phmap::flat_hash_map<int32_t, MoveEventList>;
+using MoveEventPositionMap = phmap::flat_hash_map<Position, MoveEventList>;
+
 using VocEquipMap = std::map<uint16_t, bool>;
 
 class MoveEvents final : public Scripts {
@@ -41,7 +44,7 @@ public:
 	uint32_t onPlayerDeEquip(const std::shared_ptr<Player> &player, const std::shared_ptr<Item> &item, Slots_t slot);
 	uint32_t onItemMove(const std::shared_ptr<Item> &item, const std::shared_ptr<Tile> &tile, bool isAdd);
 
-	std::map<Position, MoveEventList> getPositionsMap() const {
+	const MoveEventPositionMap &getPositionsMap() const {
 		return positionsMap;
 	}
 
@@ -57,7 +60,7 @@ public:
 		positionsMap.try_emplace(position, moveEventList);
 	}
 
-	std::map<int32_t, MoveEventList> getItemIdMap() const {
+	const MoveEventIdMap &getItemIdMap() const {
 		return itemIdMap;
 	}
 
@@ -70,10 +73,12 @@ public:
 	}
 
 	void setItemId(int32_t itemId, MoveEventList moveEventList) {
-		itemIdMap.try_emplace(itemId, moveEventList);
+		if (itemIdMap.try_emplace(itemId, moveEventList).second) {
+			updateItemIdEventTypes(itemId);
+		}
 	}
 
-	std::map<int32_t, MoveEventList> getUniqueIdMap() const {
+	const MoveEventIdMap &getUniqueIdMap() const {
 		return uniqueIdMap;
 	}
 
@@ -89,7 +94,7 @@ public:
 		uniqueIdMap.try_emplace(uniqueId, moveEventList);
 	}
 
-	std::map<int32_t, MoveEventList> getActionIdMap() const {
+	const MoveEventIdMap &getActionIdMap() const {
 		return actionIdMap;
 	}
 
@@ -115,19 +120,23 @@ public:
 	void clear(bool isFromXML = false);
 
 private:
-	void clearMap(std::map<int32_t, MoveEventList> &map) const;
-	void clearPosMap(std::map<Position, MoveEventList> &map);
+	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, MoveEventIdMap &moveListMap) const;
+	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, MoveEventPositionMap &moveListMap) const;
 
-	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, int32_t id, std::map<int32_t, MoveEventList> &moveListMap) const;
-	bool registerEvent(const std::shared_ptr<MoveEvent> moveEvent, const Position &position, std::map<Position, MoveEventList> &moveListMap) const;
+	bool hasItemIdEvent(uint16_t itemId, MoveEvent_t eventType) const {
+		return itemId < itemIdEventTypes.size() && (itemIdEventTypes[itemId] & (1 << eventType)) != 0;
+	}
+	void updateItemIdEventTypes(int32_t itemId);
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Tile> &tile, MoveEvent_t eventType);
 
 	std::shared_ptr<MoveEvent> getEvent(const std::shared_ptr<Item> &item, MoveEvent_t eventType, Slots_t slot);
 
-	std::map<int32_t, MoveEventList> uniqueIdMap;
-	std::map<int32_t, MoveEventList> actionIdMap;
-	std::map<int32_t, MoveEventList> itemIdMap;
-	std::map<Position, MoveEventList> positionsMap;
+	MoveEventIdMap uniqueIdMap;
+	MoveEventIdMap actionIdMap;
+	MoveEventIdMap itemIdMap;
+	MoveEventPositionMap positionsMap;
+	// Bit per MoveEvent_t, indexed by item id; lets the per-step checks skip item ids without scripts
+	std::vector<uint8_t> itemIdEventTypes;
 };
 
 constexpr auto g_moveEvents = MoveEvents::getInstance;
@@ -16,11 +16,31 @@ TalkActions::~TalkActions() = default;
 
 void TalkActions::clear() {
 	talkActions.clear();
+	talkActionsByWord.clear();
 }
 
 bool TalkActions::registerLuaEvent(const TalkAction_ptr &talkAction) {
-	auto [iterator, inserted] = talkActions.try_emplace(talkAction->getWords(), talkAction);
-	return inserted;
+	const std::string &talkactionWords = talkAction->getWords();
+	auto [iterator, inserted] = talkActions.try_emplace(talkactionWords, talkAction);
+	if (!inserted) {
+		return false;
+	}
+
+	const auto indexWord = [this, &talkactionWords, &talkAction](const std::string &word) {
+		auto &candidates = talkActionsByWord[word];
+		// Keep the candidates in the same order a scan over talkActions would visit them
+		auto position = std::ranges::upper_bound(candidates, talkactionWords, {}, &TalkAction::getWords);
+		candidates.insert(position, talkAction);
+	};
+
+	if (talkactionWords.find(',') != std::string::npos) {
+		for (const auto &word : split(talkactionWords)) {
+			indexWord(word);
+		}
+	} else {
+		indexWord(talkactionWords);
+	}
+	return true;
 }
 
 bool TalkActions::checkWord(std::shared_ptr<Player> player, SpeakClasses type, const std::string &words, const std::string_view &word, const TalkAction_ptr &talkActionPtr) const {
@@ -60,18 +80,18 @@ bool TalkActions::checkWord(std::shared_ptr<Player> player, SpeakClasses type, c
 }
 
 TalkActionResult_t TalkActions::checkPlayerCanSayTalkAction(std::shared_ptr<Player> player, SpeakClasses type, const std::string &words) const {
-	for (const auto &[talkactionWords, talkActionPtr] : talkActions) {
-		if (talkactionWords.find(',') != std::string::npos) {
-			auto wordsList = split(talkactionWords);
-			for (const auto &word : wordsList) {
-				if (checkWord(player, type, words, word, talkActionPtr)) {
-					return TALKACTION_BREAK;
-				}
-			}
-		} else {
-			if (checkWord(player, type, words, talkactionWords, talkActionPtr)) {
-				return TALKACTION_BREAK;
-			}
+	// Only talkactions registered for the exact first word can match, see checkWord
+	auto spacePos = std::ranges::find_if(words.begin(), words.end(), ::isspace);
+	auto it = talkActionsByWord.find(words.substr(0, spacePos - words.begin()));
+	if (it == talkActionsByWord.end()) {
+		return TALKACTION_CONTINUE;
+	}
+
+	// Copied: a talkaction such as /reload may clear the index while it runs
+	const auto [word, candidates] = *it;
+	for (const auto &talkActionPtr : candidates) {
+		if (checkWord(player, type, words, word, talkActionPtr)) {
+			return TALKACTION_BREAK;
 		}
 	}
 	return TALKACTION_CONTINUE;
@@ -94,6 +94,8 @@ public:
 
 private:
 	std::map<std::string, std::shared_ptr<TalkAction>> talkActions;
+	// Each single word of every talkaction, mapped to its candidates in talkActions order
+	std::unordered_map<std::string, std::vector<std::shared_ptr<TalkAction>>> talkActionsByWord;
 };
 
 constexpr auto g_talkActions = TalkActions::getInstance;
@@ -8,6 +8,7 @@
  */
 
 #include "core.hpp"
+#include "creatures/players/management/ban.hpp"
 #include "creatures/monsters/monster.hpp"
 #include "game/functions/game_reload.hpp"
 #include "game/game.hpp"
@@ -610,6 +611,38 @@ int GameFunctions::luaGameReload(lua_State* L) {
 	return 1;
 }
 
+int GameFunctions::luaGameAddAccountBan(lua_State* L) {
+	// Game.addAccountBan(accountId, reason, expiresAt[, bannedBy])
+	const auto accountId = getNumber<uint32_t>(L, 1);
+	const auto reason = getString(L, 2);
+	const auto expiresAt = getNumber<time_t>(L, 3);
+	const auto &bannedBy = getUserdataShared<Player>(L, 4);
+	pushBoolean(L, IOBan::addAccountBan(accountId, reason, expiresAt, bannedBy ? bannedBy->getGUID() : 0, bannedBy ? bannedBy->getName() : ""));
+	return 1;
+}
+
+int GameFunctions::luaGameRemoveAccountBan(lua_State* L) {
+	// Game.removeAccountBan(accountId)
+	pushBoolean(L, IOBan::removeAccountBan(getNumber<uint32_t>(L, 1)));
+	return 1;
+}
+
+int GameFunctions::luaGameAddIpBan(lua_State* L) {
+	// Game.addIpBan(ip, reason, expiresAt[, bannedBy])
+	const auto ip = getNumber<uint32_t>(L, 1);
+	const auto reason = getString(L, 2);
+	const auto expiresAt = getNumber<time_t>(L, 3);
+	const auto &bannedBy = getUserdataShared<Player>(L, 4);
+	pushBoolean(L, IOBan::addIpBan(ip, reason, expiresAt, bannedBy ? bannedBy->getGUID() : 0, bannedBy ? bannedBy->getName() : ""));
+	return 1;
+}
+
+int GameFunctions::luaGameRemoveIpBan(lua_State* L) {
+	// Game.removeIpBan(ip)
+	pushBoolean(L, IOBan::removeIpBan(getNumber<uint32_t>(L, 1)));
+	return 1;
+}
+
 int GameFunctions::luaGameHasEffect(lua_State* L) {
 	// Game.hasEffect(effectId)
 	uint16_t effectId = getNumber<uint16_t>(L, 1);
@@ -62,6 +62,10 @@ public:
 		registerMethod(L, "Game", "getClientVersion", GameFunctions::luaGameGetClientVersion);
 
 		registerMethod(L, "Game", "reload", GameFunctions::luaGameReload);
+		registerMethod(L, "Game", "addAccountBan", GameFunctions::luaGameAddAccountBan);
+		registerMethod(L, "Game", "removeAccountBan", GameFunctions::luaGameRemoveAccountBan);
+		registerMethod(L, "Game", "addIpBan", GameFunctions::luaGameAddIpBan);
+		registerMethod(L, "Game", "removeIpBan", GameFunctions::luaGameRemoveIpBan);
 
 		registerMethod(L, "Game", "hasDistanceEffect", GameFunctions::luaGameHasDistanceEffect);
 		registerMethod(L, "Game", "hasEffect", GameFunctions::luaGameHasEffect);
@@ -138,6 +142,10 @@ private:
 	static int luaGameGetClientVersion(lua_State* L);
 
 	static int luaGameReload(lua_State* L);
+	static int luaGameAddAccountBan(lua_State* L);
+	static int luaGameRemoveAccountBan(lua_State* L);
+	static int luaGameAddIpBan(lua_State* L);
+	static int luaGameRemoveIpBan(lua_State* L);
 
 	static int luaGameGetOfflinePlayer(lua_State* L);
 	static int luaGameGetNormalizedPlayerName(lua_State* L);
@@ -1035,7 +1035,7 @@ int MonsterTypeFunctions::luaMonsterTypeRegisterEvent(lua_State* L) {
 	if (monsterType) {
 		auto eventName = getString(L, 2);
 		monsterType->info.scripts.insert(eventName);
-		for (const auto &[_, monster] : g_game().getMonsters()) {
+		for (const auto &monster : g_game().getMonsters()) {
 			if (monster->getMonsterType() == monsterType) {
 				monster->registerCreatureEvent(eventName);
 			}
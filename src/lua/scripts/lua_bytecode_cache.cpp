@@ -0,0 +1,162 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#include "lua/scripts/lua_bytecode_cache.hpp"
+
+#include "config/configmanager.hpp"
+#include "lib/thread/thread_pool.hpp"
+
+namespace {
+#ifdef LUAJIT_VERSION
+	constexpr std::string_view luaVersion = LUAJIT_VERSION;
+#else
+	constexpr std::string_view luaVersion = LUA_RELEASE;
+#endif
+
+	int writeBytecode(lua_State*, const void* data, size_t size, void* userData) {
+		static_cast<std::string*>(userData)->append(static_cast<const char*>(data), size);
+		return 0;
+	}
+
+	std::string readFile(const std::filesystem::path &path) {
+		std::ifstream input(path, std::ios::binary);
+		if (!input) {
+			return {};
+		}
+		return { std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>() };
+	}
+}
+
+size_t LuaBytecodeCache::precompile(const std::vector<std::string> &files) {
+	if (files.empty()) {
+		return 0;
+	}
+
+	std::filesystem::path directory;
+	if (g_configManager().getBoolean(LUA_BYTECODE_CACHE)) {
+		directory = std::filesystem::current_path() / "cache" / "lua";
+		std::error_code error;
+		std::filesystem::create_directories(directory, error);
+		if (error) {
+			g_logger().warn("[{}] - Cannot create bytecode cache folder {}: {}", __FUNCTION__, directory.string(), error.message());
+			directory.clear();
+		}
+	}
+
+	std::vector<std::string> results(files.size());
+	std::vector<std::filesystem::path> cachePaths(files.size());
+	std::atomic<size_t> fromDiskCount = 0;
+	inject<ThreadPool>()
+		.submit_loop<size_t>(0, files.size(), [&](const size_t i) {
+			bool fromDisk = false;
+			results[i] = compile(files[i], directory, fromDisk, cachePaths[i]);
+			if (fromDisk) {
+				fromDiskCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		})
+		.wait();
+
+	std::scoped_lock lock(mutex);
+	for (size_t i = 0; i < files.size(); ++i) {
+		if (!results[i].empty()) {
+			compiled[files[i]] = std::move(results[i]);
+		}
+		if (!cachePaths[i].empty()) {
+			referenced.emplace(cachePaths[i].filename().string());
+		}
+	}
+	return fromDiskCount.load();
+}
+
+size_t LuaBytecodeCache::prune() {
+	std::scoped_lock lock(mutex);
+	const auto directory = std::filesystem::current_path() / "cache" / "lua";
+	std::error_code error;
+	if (!g_configManager().getBoolean(LUA_BYTECODE_CACHE) || !std::filesystem::is_directory(directory, error)) {
+		referenced.clear();
+		return 0;
+	}
+
+	size_t removed = 0;
+	for (const auto &entry : std::filesystem::directory_iterator(directory, error)) {
+		// Chunks of edited or deleted scripts, and temporary files left by an interrupted boot
+		if (entry.is_regular_file(error) && !referenced.contains(entry.path().filename().string())
+		    && std::filesystem::remove(entry.path(), error)) {
+			++removed;
+		}
+	}
+	referenced.clear();
+	return removed;
+}
+
+std::string LuaBytecodeCache::take(const std::string &file) {
+	std::scoped_lock lock(mutex);
+	auto it = compiled.find(file);
+	if (it == compiled.end()) {
+		return {};
+	}
+
+	std::string bytecode = std::move(it->second);
+	compiled.erase(it);
+	return bytecode;
+}
+
+void LuaBytecodeCache::clear() {
+	std::scoped_lock lock(mutex);
+	compiled.clear();
+}
+
+std::string LuaBytecodeCache::compile(const std::string &file, const std::filesystem::path &directory, bool &fromDisk, std::filesystem::path &cachePath) const {
+	const std::string source = readFile(file);
+	// luaL_loadfile skips a leading '#' line, leave those files to it
+	if (source.empty() || source.front() == '#') {
+		return {};
+	}
+
+	// The chunk name is embedded in the bytecode, so the path is part of the key
+	if (!directory.empty()) {
+		const auto versionHash = std::hash<std::string> {}(fmt::format("{}:{}", luaVersion, file));
+		const auto sourceHash = std::hash<std::string> {}(source);
+		cachePath = directory / fmt::format("{:016x}{:016x}.luac", versionHash, sourceHash);
+
+		if (std::string bytecode = readFile(cachePath); !bytecode.empty()) {
+			fromDisk = true;
+			return bytecode;
+		}
+	}
+
+	lua_State* L = luaL_newstate();
+	if (!L) {
+		return {};
+	}
+
+	std::string bytecode;
+	if (luaL_loadbuffer(L, source.data(), source.size(), fmt::format("@{}", file).c_str()) == 0) {
+		lua_dump(L, writeBytecode, &bytecode);
+	}
+	lua_close(L);
+
+	if (bytecode.empty() || cachePath.empty()) {
+		return bytecode;
+	}
+
+	// Write to a temporary file first so a concurrent boot never reads a partial chunk
+	const auto tempPath = std::filesystem::path(fmt::format("{}.{}", cachePath.string(), ThreadPool::getThreadId()));
+	if (std::ofstream output(tempPath, std::ios::binary | std::ios::trunc); output) {
+		output.write(bytecode.data(), static_cast<std::streamsize>(bytecode.size()));
+		output.close();
+
+		std::error_code error;
+		std::filesystem::rename(tempPath, cachePath, error);
+		if (error) {
+			std::filesystem::remove(tempPath, error);
+		}
+	}
+	return bytecode;
+}
@@ -0,0 +1,75 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include "lib/di/container.hpp"
+
+/**
+ * @brief Compiles Lua files to bytecode ahead of their execution.
+ *
+ * Parsing and bytecode generation don't touch the game state, so they are done
+ * on the thread pool, each file in its own throwaway lua_State. The result is
+ * handed to LuaScriptInterface::loadFile, which still executes every chunk
+ * serially and in the original order, keeping script registration deterministic.
+ *
+ * Compiled chunks are also stored on disk, keyed by a hash of the Lua version and
+ * the file contents, so an unchanged datapack skips the parser on the next boot.
+ */
+class LuaBytecodeCache {
+public:
+	LuaBytecodeCache() = default;
+
+	// non-copyable
+	LuaBytecodeCache(const LuaBytecodeCache &) = delete;
+	LuaBytecodeCache &operator=(const LuaBytecodeCache &) = delete;
+
+	static LuaBytecodeCache &getInstance() {
+		return inject<LuaBytecodeCache>();
+	}
+
+	/**
+	 * @brief Compiles the given files in parallel and keeps their bytecode until taken.
+	 *
+	 * Files that fail to compile are skipped, loadFile then falls back to the
+	 * regular loader and reports the error as usual.
+	 *
+	 * @return Amount of files served from the disk cache
+	 */
+	size_t precompile(const std::vector<std::string> &files);
+
+	/**
+	 * @brief Removes and returns the precompiled bytecode of a file.
+	 *
+	 * @return The bytecode, or an empty string if the file wasn't precompiled
+	 */
+	std::string take(const std::string &file);
+
+	void clear();
+
+	/**
+	 * @brief Deletes the cached chunks that no precompile() since the last prune used.
+	 *
+	 * Meant to run once every script was loaded at startup, so chunks of edited or
+	 * removed scripts don't pile up in the cache folder.
+	 *
+	 * @return Amount of files deleted
+	 */
+	size_t prune();
+
+private:
+	std::string compile(const std::string &file, const std::filesystem::path &directory, bool &fromDisk, std::filesystem::path &cachePath) const;
+
+	std::mutex mutex;
+	phmap::flat_hash_map<std::string, std::string> compiled;
+	// Names of the cache files read or written since the last prune
+	phmap::flat_hash_set<std::string> referenced;
+};
+
+constexpr auto g_luaBytecodeCache = LuaBytecodeCache::getInstance;
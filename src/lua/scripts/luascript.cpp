@@ -9,6 +9,7 @@
 
 #include "lua/scripts/luascript.hpp"
 #include "lua/scripts/lua_environment.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
 #include "lib/metrics/metrics.hpp"
 
 ScriptEnvironment::DBResultMap ScriptEnvironment::tempResults;
@@ -36,8 +37,13 @@ bool LuaScriptInterface::reInitState() {
 
 /// Same as lua_pcall, but adds stack trace to error strings in called function.
 int32_t LuaScriptInterface::loadFile(const std::string &file, const std::string &scriptName) {
-	// loads file as a chunk at stack top
-	int ret = luaL_loadfile(luaState, file.c_str());
+	// loads file as a chunk at stack top, using its precompiled bytecode when available
+	int ret;
+	if (const auto bytecode = g_luaBytecodeCache().take(file); !bytecode.empty()) {
+		ret = luaL_loadbuffer(luaState, bytecode.data(), bytecode.size(), fmt::format("@{}", file).c_str());
+	} else {
+		ret = luaL_loadfile(luaState, file.c_str());
+	}
 	if (ret != 0) {
 		lastLuaError = popString(luaState);
 		return -1;
@@ -12,6 +12,7 @@
 #include "items/weapons/weapons.hpp"
 #include "lua/creature/movement.hpp"
 #include "lua/scripts/scripts.hpp"
+#include "lua/scripts/lua_bytecode_cache.hpp"
 #include "creatures/combat/spells.hpp"
 #include "lua/callbacks/events_callbacks.hpp"
 
@@ -65,12 +66,32 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 		return false;
 	}
 
+	Benchmark bm_loadScripts;
+
+	// Collect the files first, so they can be compiled in parallel before being executed in order
+	std::vector<std::filesystem::path> scriptFiles;
+	std::vector<std::string> precompileFiles;
+	for (const auto &entry : std::filesystem::recursive_directory_iterator(dir)) {
+		const auto &realPath = entry.path();
+		if (!std::filesystem::is_regular_file(entry) || realPath.extension() != ".lua") {
+			// Skip this entry if it is not a regular file or does not have a .lua extension
+			continue;
+		}
+
+		scriptFiles.emplace_back(realPath);
+		// Disabled files and files inside "lib" or "events" folders are never executed
+		std::string fileFolder = realPath.parent_path().filename().string();
+		if (realPath.filename().string().front() != '#' && (isLib || (fileFolder != "lib" && fileFolder != "events"))) {
+			precompileFiles.emplace_back(realPath.string());
+		}
+	}
+
+	const auto fromBytecodeCache = g_luaBytecodeCache().precompile(precompileFiles);
+	size_t loadedScripts = 0;
+
 	// Declare a string variable to store the last directory
 	std::string lastDirectory;
-	// Recursive iterate through all entries in the directory
-	for (const auto &entry : std::filesystem::recursive_directory_iterator(dir)) {
-		// Get the filename of the entry as a string
-		const auto realPath = entry.path();
+	for (const auto &realPath : scriptFiles) {
 		std::string fileFolder = realPath.parent_path().filename().string();
 		// Script folder, example: "actions"
 		std::string scriptFolder = realPath.parent_path().string();
@@ -79,10 +100,6 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 		std::string_view scriptFolderView(scriptFolder);
 		// Filename, example: "demon.lua"
 		std::string file(realPath.filename().string());
-		if (!std::filesystem::is_regular_file(entry) || realPath.extension() != ".lua") {
-			// Skip this entry if it is not a regular file or does not have a .lua extension
-			continue;
-		}
 
 		// Check if file start with "#"
 		if (std::string disable("#");
@@ -114,6 +131,7 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 				g_logger().error(scriptInterface.getLastLuaError());
 				continue;
 			}
+			++loadedScripts;
 		}
 
 		if (g_configManager().getBoolean(SCRIPTS_CONSOLE_LOGS)) {
@@ -125,5 +143,9 @@ bool Scripts::loadScripts(std::string loadPath, bool isLib, bool reload) {
 		}
 	}
 
+	// Drop anything left behind by files that were not executed
+	g_luaBytecodeCache().clear();
+
+	g_logger().debug("Loaded {} scripts from {} in {} milliseconds ({} from bytecode cache)", loadedScripts, loadPath, bm_loadScripts.duration(), fromBytecodeCache);
 	return true;
 }
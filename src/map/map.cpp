@@ -392,6 +392,7 @@ void Map::moveCreature(const std::shared_ptr<Creature> &creature, const std::sha
 
 	// add the creature
 	newTile->addThing(creature);
+	new_sector->updateCreaturePosition(creature);
 
 	if (!teleport) {
 		if (oldPos.y > newPos.y) {
@@ -154,6 +154,8 @@ Spectators Spectators::find(const Position &centerPos, bool multifloor, bool onl
 	CreatureVector spectators;
 	spectators.reserve(std::max<uint8_t>(MAP_MAX_VIEW_PORT_X, MAP_MAX_VIEW_PORT_Y) * 2);
 
+	std::vector<uint32_t> indexes;
+
 	const MapSector* startSector = g_game().map.getMapSector(startx1, starty1);
 	const MapSector* sectorS = startSector;
 	for (int32_t ny = starty1; ny <= endy2; ny += SECTOR_SIZE) {
@@ -161,14 +163,11 @@ Spectators Spectators::find(const Position &centerPos, bool multifloor, bool onl
 		for (int32_t nx = startx1; nx <= endx2; nx += SECTOR_SIZE) {
 			if (sectorE) {
 				const auto &node_list = onlyPlayers ? sectorE->player_list : sectorE->creature_list;
-				for (const auto &creature : node_list) {
-					const auto &cpos = creature->getPosition();
-					if (static_cast<uint32_t>(static_cast<int32_t>(cpos.z) - minRangeZ) <= depth) {
-						const int_fast16_t offsetZ = Position::getOffsetZ(centerPos, cpos);
-						if (static_cast<uint32_t>(cpos.x - offsetZ - min_x) <= width && static_cast<uint32_t>(cpos.y - offsetZ - min_y) <= height) {
-							spectators.emplace_back(creature);
-						}
-					}
+				const auto &positions = onlyPlayers ? sectorE->playerPositions : sectorE->creaturePositions;
+				indexes.clear();
+				positions.findInRange(centerPos.z, min_x, min_y, minRangeZ, width, height, depth, indexes);
+				for (const auto index : indexes) {
+					spectators.emplace_back(node_list[index]);
 				}
 				sectorE = sectorE->sectorE;
 			} else {
@@ -12,33 +12,118 @@
 
 bool MapSector::newSector = false;
 
+void SectorPositions::findInRange(uint8_t centerZ, int32_t minX, int32_t minY, uint8_t minZ, uint32_t width, uint32_t height, uint32_t depth, std::vector<uint32_t> &indexes) const {
+	// Shifting x and y by the floor offset (centerZ - z) is the same as adding z and subtracting centerZ
+	const int32_t baseX = minX + centerZ;
+	const int32_t baseY = minY + centerZ;
+	const auto count = static_cast<uint32_t>(x.size());
+	uint32_t i = 0;
+
+#if defined(__AVX2__)
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i vBaseX = _mm256_set1_epi32(baseX);
+	const __m256i vBaseY = _mm256_set1_epi32(baseY);
+	const __m256i vMinZ = _mm256_set1_epi32(minZ);
+	const __m256i vWidth = _mm256_set1_epi32(static_cast<int32_t>(width));
+	const __m256i vHeight = _mm256_set1_epi32(static_cast<int32_t>(height));
+	const __m256i vDepth = _mm256_set1_epi32(static_cast<int32_t>(depth));
+	for (; i + 8 <= count; i += 8) {
+		const __m256i vz = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&z[i]));
+		const __m256i rx = _mm256_sub_epi32(_mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x[i])), vz), vBaseX);
+		const __m256i ry = _mm256_sub_epi32(_mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y[i])), vz), vBaseY);
+		const __m256i rz = _mm256_sub_epi32(vz, vMinZ);
+
+		// Lanes below 0 or above the limit are out of range
+		__m256i out = _mm256_or_si256(_mm256_cmpgt_epi32(zero, rz), _mm256_cmpgt_epi32(rz, vDepth));
+		out = _mm256_or_si256(out, _mm256_or_si256(_mm256_cmpgt_epi32(zero, rx), _mm256_cmpgt_epi32(rx, vWidth)));
+		out = _mm256_or_si256(out, _mm256_or_si256(_mm256_cmpgt_epi32(zero, ry), _mm256_cmpgt_epi32(ry, vHeight)));
+
+		auto mask = static_cast<uint32_t>(~_mm256_movemask_ps(_mm256_castsi256_ps(out)) & 0xFF);
+		while (mask != 0) {
+			indexes.emplace_back(i + _mm_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#elif defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i vBaseX = _mm_set1_epi32(baseX);
+	const __m128i vBaseY = _mm_set1_epi32(baseY);
+	const __m128i vMinZ = _mm_set1_epi32(minZ);
+	const __m128i vWidth = _mm_set1_epi32(static_cast<int32_t>(width));
+	const __m128i vHeight = _mm_set1_epi32(static_cast<int32_t>(height));
+	const __m128i vDepth = _mm_set1_epi32(static_cast<int32_t>(depth));
+	for (; i + 4 <= count; i += 4) {
+		const __m128i vz = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&z[i]));
+		const __m128i rx = _mm_sub_epi32(_mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&x[i])), vz), vBaseX);
+		const __m128i ry = _mm_sub_epi32(_mm_add_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&y[i])), vz), vBaseY);
+		const __m128i rz = _mm_sub_epi32(vz, vMinZ);
+
+		// Lanes below 0 or above the limit are out of range
+		__m128i out = _mm_or_si128(_mm_cmplt_epi32(rz, zero), _mm_cmpgt_epi32(rz, vDepth));
+		out = _mm_or_si128(out, _mm_or_si128(_mm_cmplt_epi32(rx, zero), _mm_cmpgt_epi32(rx, vWidth)));
+		out = _mm_or_si128(out, _mm_or_si128(_mm_cmplt_epi32(ry, zero), _mm_cmpgt_epi32(ry, vHeight)));
+
+		auto mask = static_cast<uint32_t>(~_mm_movemask_ps(_mm_castsi128_ps(out)) & 0xF);
+		while (mask != 0) {
+			indexes.emplace_back(i + _mm_ctz(mask));
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i < count; ++i) {
+		if (static_cast<uint32_t>(z[i] - minZ) <= depth
+		    && static_cast<uint32_t>(x[i] + z[i] - baseX) <= width
+		    && static_cast<uint32_t>(y[i] + z[i] - baseY) <= height) {
+			indexes.emplace_back(i);
+		}
+	}
+}
+
 void MapSector::addCreature(const std::shared_ptr<Creature> &c) {
+	c->sectorCreatureIndex = static_cast<uint32_t>(creature_list.size());
 	creature_list.emplace_back(c);
+	creaturePositions.add(c->getPosition());
 	if (c->getPlayer()) {
+		c->sectorPlayerIndex = static_cast<uint32_t>(player_list.size());
 		player_list.emplace_back(c);
+		playerPositions.add(c->getPosition());
 	}
 }
 
 void MapSector::removeCreature(const std::shared_ptr<Creature> &c) {
-	auto iter = std::find(creature_list.begin(), creature_list.end(), c);
-	if (iter == creature_list.end()) {
+	const uint32_t index = c->sectorCreatureIndex;
+	if (index >= creature_list.size() || creature_list[index] != c) {
 		g_logger().error("[{}]: Creature not found in creature_list!", __FUNCTION__);
 		return;
 	}
 
-	assert(iter != creature_list.end());
-	*iter = creature_list.back();
+	creaturePositions.swapRemove(index);
+	creature_list[index] = creature_list.back();
+	creature_list[index]->sectorCreatureIndex = index;
 	creature_list.pop_back();
 
 	if (c->getPlayer()) {
-		iter = std::find(player_list.begin(), player_list.end(), c);
-		if (iter == player_list.end()) {
+		const uint32_t playerIndex = c->sectorPlayerIndex;
+		if (playerIndex >= player_list.size() || player_list[playerIndex] != c) {
 			g_logger().error("[{}]: Player not found in player_list!", __FUNCTION__);
 			return;
 		}
 
-		assert(iter != player_list.end());
-		*iter = player_list.back();
+		playerPositions.swapRemove(playerIndex);
+		player_list[playerIndex] = player_list.back();
+		player_list[playerIndex]->sectorPlayerIndex = playerIndex;
 		player_list.pop_back();
 	}
 }
+
+void MapSector::updateCreaturePosition(const std::shared_ptr<Creature> &c) {
+	const auto &pos = c->getPosition();
+	if (c->sectorCreatureIndex < creature_list.size() && creature_list[c->sectorCreatureIndex] == c) {
+		creaturePositions.set(c->sectorCreatureIndex, pos);
+	}
+
+	if (c->getPlayer() && c->sectorPlayerIndex < player_list.size() && player_list[c->sectorPlayerIndex] == c) {
+		playerPositions.set(c->sectorPlayerIndex, pos);
+	}
+}
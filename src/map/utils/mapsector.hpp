@@ -10,6 +10,7 @@
 #pragma once
 
 #include "map/map_const.hpp"
+#include "game/movement/position.hpp"
 
 class Creature;
 class Tile;
@@ -55,6 +56,54 @@ private:
 	uint8_t z { 0 };
 };
 
+/**
+ * @brief Positions of the creatures of a sector, one packed array per coordinate, parallel to a creature list.
+ *
+ * Spectators filters them by range with SIMD, so only the creatures in range are dereferenced.
+ */
+class SectorPositions {
+public:
+	void add(const Position &pos) {
+		x.emplace_back(pos.x);
+		y.emplace_back(pos.y);
+		z.emplace_back(pos.z);
+	}
+
+	void set(size_t index, const Position &pos) {
+		x[index] = pos.x;
+		y[index] = pos.y;
+		z[index] = pos.z;
+	}
+
+	// Mirrors the swap with the back done on the creature lists
+	void swapRemove(size_t index) {
+		x[index] = x.back();
+		y[index] = y.back();
+		z[index] = z.back();
+		x.pop_back();
+		y.pop_back();
+		z.pop_back();
+	}
+
+	size_t size() const {
+		return x.size();
+	}
+
+	/**
+	 * @brief Appends the indexes of the positions visible in a range, in ascending order.
+	 *
+	 * A position matches when its floor is within [minZ, minZ + depth] and, once shifted by
+	 * its floor offset to centerZ, its x and y are within [minX, minX + width] and [minY, minY + height].
+	 */
+	void findInRange(uint8_t centerZ, int32_t minX, int32_t minY, uint8_t minZ, uint32_t width, uint32_t height, uint32_t depth, std::vector<uint32_t> &indexes) const;
+
+private:
+	// int32 lanes so the kernel doesn't need to widen them
+	std::vector<int32_t> x;
+	std::vector<int32_t> y;
+	std::vector<int32_t> z;
+};
+
 class MapSector {
 public:
 	MapSector() = default;
@@ -77,6 +126,8 @@ public:
 
 	void addCreature(const std::shared_ptr<Creature> &c);
 	void removeCreature(const std::shared_ptr<Creature> &c);
+	// Must be called after a creature moves inside the sector, so its packed position follows it
+	void updateCreaturePosition(const std::shared_ptr<Creature> &c);
 
 private:
 	static bool newSector;
@@ -84,6 +135,8 @@ private:
 	MapSector* sectorE = nullptr;
 	std::vector<std::shared_ptr<Creature>> creature_list;
 	std::vector<std::shared_ptr<Creature>> player_list;
+	SectorPositions creaturePositions;
+	SectorPositions playerPositions;
 	std::unique_ptr<Floor> floors[MAP_MAX_LAYERS] = {};
 	uint32_t floorBits = 0;
 
@@ -25,6 +25,7 @@
 // STL Includes
 // --------------------
 
+#include <bit>
 #include <bitset>
 #include <charconv>
 #include <filesystem>
@@ -45,6 +46,7 @@
 #include <numeric>
 #include <cmath>
 #include <mutex>
+#include <shared_mutex>
 #include <stack>
 #include <source_location>
 #include <span>
@@ -70,6 +72,7 @@
 // --------------------
 
 // ABSL
+#include <absl/container/inlined_vector.h>
 #include <absl/numeric/int128.h>
 
 // ASIO
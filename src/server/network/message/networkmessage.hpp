@@ -177,3 +177,34 @@ protected:
 	NetworkMessageInfo info;
 	std::array<uint8_t, NETWORKMESSAGE_MAXSIZE> buffer = {};
 };
+
+/**
+ * @brief Packet shared by every viewer of the same event.
+ *
+ * Broadcasts build one instance per event and pass it to each viewer's protocol.
+ * The payload is encoded by the first viewer of each protocol variant (current
+ * and old protocol) and then copied as is into the output buffer of the others,
+ * instead of being rebuilt for every one of them. Only packets whose bytes don't
+ * depend on the viewer, other than the protocol variant, can be shared.
+ */
+class SharedNetworkMessage {
+public:
+	SharedNetworkMessage() = default;
+
+	// non-copyable
+	SharedNetworkMessage(const SharedNetworkMessage &) = delete;
+	SharedNetworkMessage &operator=(const SharedNetworkMessage &) = delete;
+
+	template <typename Encoder>
+	const NetworkMessage &get(bool oldProtocol, Encoder &&encode) {
+		auto &message = messages[oldProtocol ? 1 : 0];
+		if (!message) {
+			message = std::make_unique<NetworkMessage>();
+			encode(*message);
+		}
+		return *message;
+	}
+
+private:
+	std::array<std::unique_ptr<NetworkMessage>, 2> messages;
+};
@@ -32,6 +32,12 @@ void OutputMessagePool::sendAll() {
 		if (msg) {
 			protocol->send(std::move(msg));
 		}
+
+		// Only one of the two buffers is pending at a time, see Protocol::getBulkOutputBuffer
+		auto &bulkMsg = protocol->getCurrentBulkBuffer();
+		if (bulkMsg) {
+			protocol->send(std::move(bulkMsg));
+		}
 	}
 
 	if (!bufferedProtocols.empty()) {
@@ -48,6 +48,22 @@ public:
 		info.position += msgLen;
 	}
 
+	/**
+	 * @brief Replaces a previously appended message with another of the same length.
+	 *
+	 * @param position Buffer position the replaced message was appended at
+	 */
+	void overwrite(MsgSize_t position, const NetworkMessage &msg) {
+		auto msgLen = msg.getLength();
+		if (position < INITIAL_BUFFER_POSITION || position + msgLen > info.position) {
+			g_logger().error("[{}]: Overwrite out of bounds, position: '{}', length: '{}'", __FUNCTION__, position, msgLen);
+			return;
+		}
+
+		std::span<const unsigned char> sourceSpan(msg.getBuffer() + INITIAL_BUFFER_POSITION, msgLen);
+		std::ranges::copy(sourceSpan, buffer.begin() + position);
+	}
+
 	void append(const OutputMessage_ptr &msg) {
 		auto msgLen = msg->getLength();
 		std::span<const unsigned char> sourceSpan(msg->getBuffer() + INITIAL_BUFFER_POSITION, msgLen);
@@ -0,0 +1,159 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+/**
+ * @brief Creatures known by a game client, ordered from the most to the least recently seen.
+ *
+ * The client only remembers a limited amount of creatures, so when it is full the
+ * server has to pick one to forget. Walking from the least recently seen end finds
+ * a creature that is no longer on screen right away in practice, instead of
+ * scanning the whole table.
+ *
+ * Entries live in a vector linked as a doubly linked list, with a flat map from
+ * creature id to slot, so touching, inserting and removing are all O(1).
+ */
+class KnownCreatures {
+public:
+	/**
+	 * @brief Marks a creature as the most recently seen one, adding it if needed.
+	 *
+	 * @return true if the creature was already known
+	 */
+	bool touch(uint32_t id) {
+		if (auto it = slots.find(id); it != slots.end()) {
+			unlink(it->second);
+			linkFront(it->second);
+			return true;
+		}
+
+		uint32_t slot;
+		if (freeSlots.empty()) {
+			slot = static_cast<uint32_t>(nodes.size());
+			nodes.emplace_back();
+		} else {
+			slot = freeSlots.back();
+			freeSlots.pop_back();
+		}
+
+		nodes[slot].id = id;
+		linkFront(slot);
+		slots.emplace(id, slot);
+		return false;
+	}
+
+	bool contains(uint32_t id) const {
+		return slots.contains(id);
+	}
+
+	bool erase(uint32_t id) {
+		auto it = slots.find(id);
+		if (it == slots.end()) {
+			return false;
+		}
+
+		const uint32_t slot = it->second;
+		slots.erase(it);
+		unlink(slot);
+		freeSlots.emplace_back(slot);
+		return true;
+	}
+
+	/**
+	 * @brief Forgets the least recently seen creature accepted by the predicate.
+	 *
+	 * Falls back to the least recently seen creature if none is accepted.
+	 *
+	 * @param keep Creature that must never be evicted, usually the one just added
+	 * @param canEvict Called with creature ids from the least recently seen onwards
+	 * @return Id of the evicted creature, or 0 if there was nothing to evict
+	 */
+	template <typename Predicate>
+	uint32_t evict(uint32_t keep, Predicate &&canEvict) {
+		uint32_t fallback = NONE;
+		for (uint32_t slot = tail; slot != NONE; slot = nodes[slot].prev) {
+			const uint32_t id = nodes[slot].id;
+			if (id == keep) {
+				continue;
+			}
+
+			if (fallback == NONE) {
+				fallback = slot;
+			}
+
+			if (canEvict(id)) {
+				erase(id);
+				return id;
+			}
+		}
+
+		if (fallback == NONE) {
+			return 0;
+		}
+
+		const uint32_t id = nodes[fallback].id;
+		erase(id);
+		return id;
+	}
+
+	size_t size() const {
+		return slots.size();
+	}
+
+	void clear() {
+		nodes.clear();
+		freeSlots.clear();
+		slots.clear();
+		head = NONE;
+		tail = NONE;
+	}
+
+private:
+	static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+	struct Node {
+		uint32_t id = 0;
+		uint32_t prev = NONE;
+		uint32_t next = NONE;
+	};
+
+	void linkFront(uint32_t slot) {
+		auto &node = nodes[slot];
+		node.prev = NONE;
+		node.next = head;
+		if (head != NONE) {
+			nodes[head].prev = slot;
+		} else {
+			tail = slot;
+		}
+		head = slot;
+	}
+
+	void unlink(uint32_t slot) {
+		const auto &node = nodes[slot];
+		if (node.prev != NONE) {
+			nodes[node.prev].next = node.next;
+		} else {
+			head = node.next;
+		}
+
+		if (node.next != NONE) {
+			nodes[node.next].prev = node.prev;
+		} else {
+			tail = node.prev;
+		}
+	}
+
+	std::vector<Node> nodes;
+	std::vector<uint32_t> freeSlots;
+	phmap::flat_hash_map<uint32_t, uint32_t> slots;
+	uint32_t head = NONE;
+	uint32_t tail = NONE;
+};
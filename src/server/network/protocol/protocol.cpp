@@ -14,6 +14,8 @@
 #include "server/network/message/outputmessage.hpp"
 #include "security/rsa.hpp"
 #include "game/scheduling/dispatcher.hpp"
+#include "lib/thread/thread_pool.hpp"
+#include "lib/di/container.hpp"
 
 Protocol::Protocol(Connection_ptr initConnection) :
 	connectionPtr(initConnection) { }
@@ -104,15 +106,38 @@ bool Protocol::onRecvMessage(NetworkMessage &msg) {
 
 OutputMessage_ptr Protocol::getOutputBuffer(int32_t size) {
 	// dispatcher thread
+	// A pending bulk reply was written first, so it has to reach the client first
+	if (bulkOutputBuffer) {
+		send(std::move(bulkOutputBuffer));
+	}
+
 	if (!outputBuffer) {
 		outputBuffer = OutputMessagePool::getOutputMessage();
+		++outputBufferId;
 	} else if ((outputBuffer->getLength() + size) > MAX_PROTOCOL_BODY_LENGTH) {
 		send(outputBuffer);
 		outputBuffer = OutputMessagePool::getOutputMessage();
+		++outputBufferId;
 	}
 	return outputBuffer;
 }
 
+OutputMessage_ptr Protocol::getBulkOutputBuffer(int32_t size) {
+	// dispatcher thread
+	// Regular packets written before the bulk reply have to reach the client first
+	if (outputBuffer) {
+		send(std::move(outputBuffer));
+	}
+
+	if (!bulkOutputBuffer) {
+		bulkOutputBuffer = OutputMessagePool::getOutputMessage();
+	} else if ((bulkOutputBuffer->getLength() + size) > MAX_PROTOCOL_BODY_LENGTH) {
+		send(bulkOutputBuffer);
+		bulkOutputBuffer = OutputMessagePool::getOutputMessage();
+	}
+	return bulkOutputBuffer;
+}
+
 void Protocol::send(OutputMessage_ptr msg) const {
 	if (auto connection = getConnection()) {
 		connection->send(msg);
@@ -209,6 +234,52 @@ bool Protocol::RSA_decrypt(NetworkMessage &msg) {
 	return (msg.getByte() == 0);
 }
 
+namespace {
+	struct LoginTasks {
+		std::mutex mutex;
+		std::deque<std::function<void(void)>> pending;
+		size_t running = 0;
+	};
+
+	LoginTasks &getLoginTasks() {
+		static LoginTasks loginTasks;
+		return loginTasks;
+	}
+
+	void runLoginTask(std::function<void(void)> task) {
+		inject<ThreadPool>().detach_task([task = std::move(task)]() mutable {
+			task();
+
+			auto &loginTasks = getLoginTasks();
+			std::unique_lock lock(loginTasks.mutex);
+			if (loginTasks.pending.empty()) {
+				--loginTasks.running;
+				return;
+			}
+
+			auto next = std::move(loginTasks.pending.front());
+			loginTasks.pending.pop_front();
+			lock.unlock();
+			runLoginTask(std::move(next));
+		});
+	}
+}
+
+void Protocol::addLoginTask(std::function<void(void)> &&task) {
+	auto &loginTasks = getLoginTasks();
+	const size_t maxRunning = std::max<size_t>(1, inject<ThreadPool>().get_thread_count() / 2);
+	{
+		std::scoped_lock lock(loginTasks.mutex);
+		if (loginTasks.running >= maxRunning) {
+			loginTasks.pending.emplace_back(std::move(task));
+			return;
+		}
+		++loginTasks.running;
+	}
+
+	runLoginTask(std::move(task));
+}
+
 bool Protocol::isConnectionExpired() const {
 	return connectionPtr.expired();
 }
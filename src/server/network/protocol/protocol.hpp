@@ -45,10 +45,23 @@ public:
 
 	// Use this function for autosend messages only
 	OutputMessage_ptr getOutputBuffer(int32_t size);
+	// Same as getOutputBuffer, for large replies kept apart from the regular buffer
+	// Switching between the two flushes the other one first, so the client sees packets in write order
+	OutputMessage_ptr getBulkOutputBuffer(int32_t size);
 
 	OutputMessage_ptr &getCurrentBuffer() {
 		return outputBuffer;
 	}
+	OutputMessage_ptr &getCurrentBulkBuffer() {
+		return bulkOutputBuffer;
+	}
+
+	/**
+	 * @brief Identifies the current autosend buffer, changes every time a new one is started.
+	 */
+	uint32_t getOutputBufferId() const {
+		return outputBufferId;
+	}
 
 	void send(OutputMessage_ptr msg) const;
 
@@ -67,6 +80,14 @@ protected:
 
 	static bool RSA_decrypt(NetworkMessage &msg);
 
+	/**
+	 * @brief Runs a blocking login step (ban checks, account load, password hashing) on the thread pool.
+	 *
+	 * Keeps these off the network and dispatcher threads. At most half of the pool
+	 * works on logins at a time, the remaining tasks wait in arrival order.
+	 */
+	static void addLoginTask(std::function<void(void)> &&task);
+
 	void setRawMessages(bool value) {
 		rawMessages = value;
 	}
@@ -90,6 +111,8 @@ private:
 	bool compression(OutputMessage &msg) const;
 
 	OutputMessage_ptr outputBuffer;
+	OutputMessage_ptr bulkOutputBuffer;
+	uint32_t outputBufferId = 0;
 
 	const ConnectionWeak_ptr connectionPtr;
 	std::array<uint32_t, 4> key = {};
@@ -464,7 +464,7 @@ void ProtocolGame::release() {
 	Protocol::release();
 }
 
-void ProtocolGame::login(const std::string &name, uint32_t accountId, OperatingSystem_t operatingSystem) {
+void ProtocolGame::login(const std::string &name, uint32_t accountId, OperatingSystem_t operatingSystem, bool namelocked, const std::string &accountBanMessage) {
 	// OTCV8 features
 	if (otclientV8 > 0) {
 		sendFeatures();
@@ -497,7 +497,7 @@ void ProtocolGame::login(const std::string &name, uint32_t accountId, OperatingS
 			return;
 		}
 
-		if (IOBan::isPlayerNamelocked(player->getGUID())) {
+		if (namelocked) {
 			g_game().removePlayerUniqueLogin(player);
 			disconnectClient("Your character has been namelocked.");
 			return;
@@ -534,25 +534,10 @@ void ProtocolGame::login(const std::string &name, uint32_t accountId, OperatingS
 			return;
 		}
 
-		if (!player->hasFlag(PlayerFlags_t::CannotBeBanned)) {
-			BanInfo banInfo;
-			if (IOBan::isAccountBanned(accountId, banInfo)) {
-				if (banInfo.reason.empty()) {
-					banInfo.reason = "(none)";
-				}
-
-				std::ostringstream ss;
-				if (banInfo.expiresAt > 0) {
-					ss << "Your account has been banned until " << formatDateShort(banInfo.expiresAt) << " by " << banInfo.bannedBy << ".\n\nReason specified:\n"
-					   << banInfo.reason;
-				} else {
-					ss << "Your account has been permanently banned by " << banInfo.bannedBy << ".\n\nReason specified:\n"
-					   << banInfo.reason;
-				}
-				g_game().removePlayerUniqueLogin(player);
-				disconnectClient(ss.str());
-				return;
-			}
+		if (!accountBanMessage.empty() && !player->hasFlag(PlayerFlags_t::CannotBeBanned)) {
+			g_game().removePlayerUniqueLogin(player);
+			disconnectClient(accountBanMessage);
+			return;
 		}
 
 		WaitingList &waitingList = WaitingList::getInstance();
@@ -825,39 +810,71 @@ void ProtocolGame::onRecvFirstMessage(NetworkMessage &msg) {
 		return;
 	}
 
-	BanInfo banInfo;
-	if (IOBan::isIpBanned(getIP(), banInfo)) {
-		if (banInfo.reason.empty()) {
-			banInfo.reason = "(none)";
+	// Ban lookups, account load and Argon2 block on the database, the dispatcher only gets the authenticated character
+	addLoginTask([self = getThis(), ip = getIP(), accountDescriptor, password, characterName, authType, operatingSystem]() mutable {
+		BanInfo banInfo;
+		if (IOBan::isIpBanned(ip, banInfo)) {
+			if (banInfo.reason.empty()) {
+				banInfo.reason = "(none)";
+			}
+
+			std::ostringstream ss;
+			ss << "Your IP has been banned until " << formatDateShort(banInfo.expiresAt) << " by " << banInfo.bannedBy << ".\n\nReason specified:\n"
+			   << banInfo.reason;
+			self->disconnectClient(ss.str());
+			return;
 		}
 
-		ss.str(std::string());
-		ss << "Your IP has been banned until " << formatDateShort(banInfo.expiresAt) << " by " << banInfo.bannedBy << ".\n\nReason specified:\n"
-		   << banInfo.reason;
-		disconnectClient(ss.str());
-		return;
-	}
+		uint32_t accountId;
+		if (!IOLoginData::gameWorldAuthentication(accountDescriptor, password, characterName, accountId, self->oldProtocol, ip)) {
+			std::ostringstream ss;
+			if (authType == "session") {
+				ss << "Your session has expired. Please log in again.";
+			} else { // authType == "password"
+				ss << "Your " << (self->oldProtocol ? "username" : "email") << " or password is not correct.";
+			}
 
-	uint32_t accountId;
-	if (!IOLoginData::gameWorldAuthentication(accountDescriptor, password, characterName, accountId, oldProtocol, getIP())) {
-		ss.str(std::string());
-		if (authType == "session") {
-			ss << "Your session has expired. Please log in again.";
-		} else { // authType == "password"
-			ss << "Your " << (oldProtocol ? "username" : "email") << " or password is not correct.";
+			auto output = OutputMessagePool::getOutputMessage();
+			output->addByte(0x14);
+			output->addString(ss.str());
+			self->send(output);
+			g_dispatcher().scheduleEvent(
+				1000, [self] { self->disconnect(); }, "ProtocolGame::disconnect"
+			);
+			return;
 		}
 
-		auto output = OutputMessagePool::getOutputMessage();
-		output->addByte(0x14);
-		output->addString(ss.str());
-		send(output);
-		g_dispatcher().scheduleEvent(
-			1000, [self = getThis()] { self->disconnect(); }, "ProtocolGame::disconnect"
-		);
-		return;
-	}
+		const auto guid = IOLoginData::getGuidByName(characterName);
+		const bool namelocked = IOBan::isPlayerNamelocked(guid);
+		if (guid != 0) {
+			// Loads the character's whole KV scope here, so its lookups on the dispatcher never reach the database
+			g_kv().prefetch(fmt::format("player.{}", guid));
+		}
 
-	g_dispatcher().addEvent([self = getThis(), characterName, accountId, operatingSystem] { self->login(characterName, accountId, operatingSystem); }, __FUNCTION__);
+		std::string accountBanMessage;
+		if (IOBan::isAccountBanned(accountId, banInfo)) {
+			if (banInfo.reason.empty()) {
+				banInfo.reason = "(none)";
+			}
+
+			std::ostringstream ss;
+			if (banInfo.expiresAt > 0) {
+				ss << "Your account has been banned until " << formatDateShort(banInfo.expiresAt) << " by " << banInfo.bannedBy << ".\n\nReason specified:\n"
+				   << banInfo.reason;
+			} else {
+				ss << "Your account has been permanently banned by " << banInfo.bannedBy << ".\n\nReason specified:\n"
+				   << banInfo.reason;
+			}
+			accountBanMessage = ss.str();
+		}
+
+		g_dispatcher().addEvent(
+			[self, characterName, accountId, operatingSystem, namelocked, accountBanMessage] {
+				self->login(characterName, accountId, operatingSystem, namelocked, accountBanMessage);
+			},
+			"ProtocolGame::login"
+		);
+	});
 }
 
 void ProtocolGame::onConnect() {
@@ -901,6 +918,35 @@ void ProtocolGame::writeToOutputBuffer(const NetworkMessage &msg) {
 	out->append(msg);
 }
 
+void ProtocolGame::writeToOutputBuffer(const NetworkMessage &msg, CoalescedPacket_t type, uint32_t creatureId) {
+	auto out = getOutputBuffer(msg.getLength());
+	// Positions are only valid for the buffer they were recorded in
+	if (coalescedBufferId != getOutputBufferId()) {
+		coalescedPackets.clear();
+		coalescedBufferId = getOutputBufferId();
+	}
+
+	const auto key = (static_cast<uint64_t>(type) << 32) | creatureId;
+	if (auto it = coalescedPackets.find(key);
+	    it != coalescedPackets.end() && it->second.length == msg.getLength()) {
+		out->overwrite(it->second.position, msg);
+		return;
+	}
+
+	coalescedPackets[key] = { out->getBufferPosition(), msg.getLength() };
+	out->append(msg);
+}
+
+void ProtocolGame::forgetCoalescedPackets(uint32_t creatureId) {
+	coalescedPackets.erase((static_cast<uint64_t>(CoalescedPacket_t::Speed) << 32) | creatureId);
+	coalescedPackets.erase((static_cast<uint64_t>(CoalescedPacket_t::Health) << 32) | creatureId);
+}
+
+void ProtocolGame::writeToBulkOutputBuffer(const NetworkMessage &msg) {
+	auto out = getBulkOutputBuffer(msg.getLength());
+	out->append(msg);
+}
+
 void ProtocolGame::parsePacket(NetworkMessage &msg) {
 	if (!acceptPackets || g_game().getGameState() == GAME_STATE_SHUTDOWN || msg.getLength() <= 0) {
 		return;
@@ -1498,42 +1544,23 @@ void ProtocolGame::GetFloorDescription(NetworkMessage &msg, int32_t x, int32_t y
 }
 
 void ProtocolGame::checkCreatureAsKnown(uint32_t id, bool &known, uint32_t &removedKnown) {
-	if (auto [creatureKnown, creatureInserted] = knownCreatureSet.insert(id);
-	    !creatureInserted) {
+	if (knownCreatures.touch(id)) {
 		known = true;
 		return;
 	}
 	known = false;
-	if (knownCreatureSet.size() > 1300) {
-		// Look for a creature to remove
-		for (auto it = knownCreatureSet.begin(), end = knownCreatureSet.end(); it != end; ++it) {
-			if (*it == id) {
-				continue;
-			}
+	if (knownCreatures.size() > 1300) {
+		// Look for a creature to remove, starting from the one seen the longest time ago.
+		// If every creature is still relevant, the least recently seen one is removed anyway.
+		removedKnown = knownCreatures.evict(id, [this](uint32_t knownId) {
 			// We need to protect party players from removing
-			std::shared_ptr<Creature> creature = g_game().getCreatureByID(*it);
+			std::shared_ptr<Creature> creature = g_game().getCreatureByID(knownId);
 			if (std::shared_ptr<Player> checkPlayer;
 			    creature && (checkPlayer = creature->getPlayer()) != nullptr) {
-				if (player->getParty() != checkPlayer->getParty() && !canSee(creature)) {
-					removedKnown = *it;
-					knownCreatureSet.erase(it);
-					return;
-				}
-			} else if (!canSee(creature)) {
-				removedKnown = *it;
-				knownCreatureSet.erase(it);
-				return;
+				return player->getParty() != checkPlayer->getParty() && !canSee(creature);
 			}
-		}
-
-		// Bad situation. Let's just remove anyone.
-		auto it = knownCreatureSet.begin();
-		if (*it == id) {
-			++it;
-		}
-
-		removedKnown = *it;
-		knownCreatureSet.erase(it);
+			return !canSee(creature);
+		});
 	} else {
 		removedKnown = 0;
 	}
@@ -2191,7 +2218,7 @@ void ProtocolGame::sendHighscoresNoData() {
 	NetworkMessage msg;
 	msg.addByte(0xB1);
 	msg.addByte(0x01); // No data available
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendHighscores(const std::vector<HighscoreCharacter> &characters, uint8_t categoryId, uint32_t vocationId, uint16_t page, uint16_t pages, uint32_t updateTimer) {
@@ -2268,7 +2295,7 @@ void ProtocolGame::sendHighscores(const std::vector<HighscoreCharacter> &charact
 	msg.add<uint32_t>(updateTimer); // Last Update
 	msg.setBufferPosition(vocationPosition);
 	msg.addByte(vocations);
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::parseConfigureShowOffSocket(NetworkMessage &msg) {
@@ -3437,7 +3464,7 @@ void ProtocolGame::sendCyclopediaCharacterNoData(CyclopediaCharacterInfoType_t c
 	msg.addByte(0xDA);
 	msg.addByte(static_cast<uint8_t>(characterInfoType));
 	msg.addByte(errorCode);
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterBaseInformation() {
@@ -3456,7 +3483,7 @@ void ProtocolGame::sendCyclopediaCharacterBaseInformation() {
 
 	msg.addByte(0x01); // Store summary & Character titles
 	msg.addString(player->title()->getCurrentTitleName()); // character title
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterGeneralStats() {
@@ -3527,7 +3554,7 @@ void ProtocolGame::sendCyclopediaCharacterGeneralStats() {
 	}
 	msg.setBufferPosition(bufferPosition);
 	msg.addByte(total);
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterCombatStats() {
@@ -3683,7 +3710,7 @@ void ProtocolGame::sendCyclopediaCharacterCombatStats() {
 	msg.setBufferPosition(startConcoctions);
 	msg.addByte(concoctions);
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterRecentDeaths(uint16_t page, uint16_t pages, const std::vector<RecentDeathEntry> &entries) {
@@ -3703,7 +3730,7 @@ void ProtocolGame::sendCyclopediaCharacterRecentDeaths(uint16_t page, uint16_t p
 		msg.addString(entry.cause);
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterRecentPvPKills(uint16_t page, uint16_t pages, const std::vector<RecentPvPKillEntry> &entries) {
@@ -3724,7 +3751,7 @@ void ProtocolGame::sendCyclopediaCharacterRecentPvPKills(uint16_t page, uint16_t
 		msg.addByte(entry.status);
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterAchievements(uint16_t secretsUnlocked, std::vector<std::pair<Achievement, uint32_t>> achievementsUnlocked) {
@@ -3751,7 +3778,7 @@ void ProtocolGame::sendCyclopediaCharacterAchievements(uint16_t secretsUnlocked,
 			msg.addByte(0x00);
 		}
 	}
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterItemSummary(const ItemsTierCountList &inventoryItems, const ItemsTierCountList &storeInboxItems, const StashItemList &supplyStashItems, const ItemsTierCountList &depotBoxItems, const ItemsTierCountList &inboxItems) {
@@ -3863,7 +3890,7 @@ void ProtocolGame::sendCyclopediaCharacterItemSummary(const ItemsTierCountList &
 	msg.setBufferPosition(startInbox);
 	msg.add<uint16_t>(inboxItemsCount);
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterOutfitsMounts() {
@@ -3966,7 +3993,7 @@ void ProtocolGame::sendCyclopediaCharacterOutfitsMounts() {
 	msg.add<uint16_t>(mountSize);
 	msg.setBufferPosition(startFamiliars);
 	msg.add<uint16_t>(familiarsSize);
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterStoreSummary() {
@@ -4048,7 +4075,7 @@ void ProtocolGame::sendCyclopediaCharacterStoreSummary() {
 		msg.addByte(hItem_it.second);
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterInspection() {
@@ -4186,7 +4213,7 @@ void ProtocolGame::sendCyclopediaCharacterInspection() {
 	msg.setBufferPosition(playerDescriptionPosition);
 	msg.addByte(playerDescriptionSize);
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterBadges() {
@@ -4220,7 +4247,7 @@ void ProtocolGame::sendCyclopediaCharacterBadges() {
 	msg.setBufferPosition(badgesSizePosition);
 	msg.addByte(badgesSize);
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCyclopediaCharacterTitles() {
@@ -4246,7 +4273,7 @@ void ProtocolGame::sendCyclopediaCharacterTitles() {
 		msg.addByte(isUnlocked ? 0x01 : 0x00);
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendReLoginWindow(uint8_t unfairFightReduction) {
@@ -4263,7 +4290,7 @@ void ProtocolGame::sendReLoginWindow(uint8_t unfairFightReduction) {
 void ProtocolGame::sendStats() {
 	NetworkMessage msg;
 	AddPlayerStats(msg);
-	writeToOutputBuffer(msg);
+	writeToOutputBuffer(msg, CoalescedPacket_t::Stats);
 }
 
 void ProtocolGame::sendBasicData() {
@@ -5086,7 +5113,7 @@ void ProtocolGame::sendMarketBrowseItem(uint16_t itemId, const MarketOfferList &
 	}
 
 	updateCoinBalance();
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendMarketAcceptOffer(const MarketOfferEx &offer) {
@@ -5171,7 +5198,7 @@ void ProtocolGame::sendMarketBrowseOwnOffers(const MarketOfferList &buyOffers, c
 		}
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendMarketCancelOffer(const MarketOfferEx &offer) {
@@ -5265,7 +5292,7 @@ void ProtocolGame::sendMarketBrowseOwnHistory(const HistoryMarketOfferList &buyO
 		msg.addByte(it->state);
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendForgingData() {
@@ -6073,7 +6100,7 @@ void ProtocolGame::sendMarketDetail(uint16_t itemId, uint8_t tier) {
 		msg.addByte(0x00); // send to old protocol ?
 	}
 
-	writeToOutputBuffer(msg);
+	writeToBulkOutputBuffer(msg);
 }
 
 void ProtocolGame::sendTradeItemRequest(const std::string &traderName, std::shared_ptr<Item> item, bool ack) {
@@ -6146,6 +6173,17 @@ void ProtocolGame::sendCreatureTurn(std::shared_ptr<Creature> creature, uint32_t
 
 void ProtocolGame::sendCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses type, const std::string &text, const Position* pos /* = nullptr*/) {
 	NetworkMessage msg;
+	AddCreatureSay(msg, creature, type, text, pos);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::sendCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses type, const std::string &text, const Position* pos, SharedNetworkMessage &message) {
+	writeToOutputBuffer(message.get(oldProtocol, [&](NetworkMessage &msg) {
+		AddCreatureSay(msg, creature, type, text, pos);
+	}));
+}
+
+void ProtocolGame::AddCreatureSay(NetworkMessage &msg, const std::shared_ptr<Creature> &creature, SpeakClasses type, const std::string &text, const Position* pos) const {
 	msg.addByte(0xAA);
 
 	static uint32_t statementId = 0;
@@ -6177,7 +6215,6 @@ void ProtocolGame::sendCreatureSay(std::shared_ptr<Creature> creature, SpeakClas
 	}
 
 	msg.addString(text);
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendToChannel(std::shared_ptr<Creature> creature, SpeakClasses type, const std::string &text, uint16_t channelId) {
@@ -6259,11 +6296,22 @@ void ProtocolGame::sendCancelTarget() {
 
 void ProtocolGame::sendChangeSpeed(std::shared_ptr<Creature> creature, uint16_t speed) {
 	NetworkMessage msg;
+	AddChangeSpeed(msg, creature, speed);
+	writeToOutputBuffer(msg, CoalescedPacket_t::Speed, creature->getID());
+}
+
+void ProtocolGame::sendChangeSpeed(std::shared_ptr<Creature> creature, uint16_t speed, SharedNetworkMessage &message) {
+	const auto &sharedMsg = message.get(oldProtocol, [&](NetworkMessage &msg) {
+		AddChangeSpeed(msg, creature, speed);
+	});
+	writeToOutputBuffer(sharedMsg, CoalescedPacket_t::Speed, creature->getID());
+}
+
+void ProtocolGame::AddChangeSpeed(NetworkMessage &msg, const std::shared_ptr<Creature> &creature, uint16_t speed) const {
 	msg.addByte(0x8F);
 	msg.add<uint32_t>(creature->getID());
 	msg.add<uint16_t>(creature->getBaseSpeed());
 	msg.add<uint16_t>(speed);
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendCancelWalk() {
@@ -6278,7 +6326,7 @@ void ProtocolGame::sendCancelWalk() {
 void ProtocolGame::sendSkills() {
 	NetworkMessage msg;
 	AddPlayerSkills(msg);
-	writeToOutputBuffer(msg);
+	writeToOutputBuffer(msg, CoalescedPacket_t::Skills);
 }
 
 void ProtocolGame::sendPing() {
@@ -6300,6 +6348,20 @@ void ProtocolGame::sendDistanceShoot(const Position &from, const Position &to, u
 		return;
 	}
 	NetworkMessage msg;
+	AddDistanceShoot(msg, from, to, type);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::sendDistanceShoot(const Position &from, const Position &to, uint16_t type, SharedNetworkMessage &message) {
+	if (oldProtocol && type > 0xFF) {
+		return;
+	}
+	writeToOutputBuffer(message.get(oldProtocol, [&](NetworkMessage &msg) {
+		AddDistanceShoot(msg, from, to, type);
+	}));
+}
+
+void ProtocolGame::AddDistanceShoot(NetworkMessage &msg, const Position &from, const Position &to, uint16_t type) const {
 	if (oldProtocol) {
 		msg.addByte(0x85);
 		msg.addPosition(from);
@@ -6314,7 +6376,6 @@ void ProtocolGame::sendDistanceShoot(const Position &from, const Position &to, u
 		msg.addByte(static_cast<uint8_t>(static_cast<int8_t>(static_cast<int32_t>(to.y) - static_cast<int32_t>(from.y))));
 		msg.addByte(MAGIC_EFFECTS_END_LOOP);
 	}
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendRestingStatus(uint8_t protection) {
@@ -6368,6 +6429,21 @@ void ProtocolGame::sendMagicEffect(const Position &pos, uint16_t type) {
 	}
 
 	NetworkMessage msg;
+	AddMagicEffect(msg, pos, type);
+	writeToOutputBuffer(msg);
+}
+
+void ProtocolGame::sendMagicEffect(const Position &pos, uint16_t type, SharedNetworkMessage &message) {
+	if (!canSee(pos) || (oldProtocol && type > 0xFF)) {
+		return;
+	}
+
+	writeToOutputBuffer(message.get(oldProtocol, [&](NetworkMessage &msg) {
+		AddMagicEffect(msg, pos, type);
+	}));
+}
+
+void ProtocolGame::AddMagicEffect(NetworkMessage &msg, const Position &pos, uint16_t type) const {
 	if (oldProtocol) {
 		msg.addByte(0x83);
 		msg.addPosition(pos);
@@ -6379,7 +6455,6 @@ void ProtocolGame::sendMagicEffect(const Position &pos, uint16_t type) {
 		msg.add<uint16_t>(type);
 		msg.addByte(MAGIC_EFFECTS_END_LOOP);
 	}
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::removeMagicEffect(const Position &pos, uint16_t type) {
@@ -6403,6 +6478,22 @@ void ProtocolGame::sendCreatureHealth(std::shared_ptr<Creature> creature) {
 	}
 
 	NetworkMessage msg;
+	AddCreatureHealth(msg, creature);
+	writeToOutputBuffer(msg, CoalescedPacket_t::Health, creature->getID());
+}
+
+void ProtocolGame::sendCreatureHealth(std::shared_ptr<Creature> creature, SharedNetworkMessage &message) {
+	if (creature->isHealthHidden()) {
+		return;
+	}
+
+	const auto &sharedMsg = message.get(oldProtocol, [&](NetworkMessage &msg) {
+		AddCreatureHealth(msg, creature);
+	});
+	writeToOutputBuffer(sharedMsg, CoalescedPacket_t::Health, creature->getID());
+}
+
+void ProtocolGame::AddCreatureHealth(NetworkMessage &msg, const std::shared_ptr<Creature> &creature) const {
 	msg.addByte(0x8C);
 	msg.add<uint32_t>(creature->getID());
 	if (creature->isHealthHidden()) {
@@ -6410,8 +6501,6 @@ void ProtocolGame::sendCreatureHealth(std::shared_ptr<Creature> creature) {
 	} else {
 		msg.addByte(static_cast<uint8_t>(std::min<double>(100, std::ceil((static_cast<double>(creature->getHealth()) / std::max<int32_t>(creature->getMaxHealth(), 1)) * 100))));
 	}
-
-	writeToOutputBuffer(msg);
 }
 
 void ProtocolGame::sendPartyCreatureUpdate(std::shared_ptr<Creature> target) {
@@ -6434,7 +6523,7 @@ void ProtocolGame::sendPartyCreatureUpdate(std::shared_ptr<Creature> target) {
 
 void ProtocolGame::sendPartyCreatureShield(std::shared_ptr<Creature> target) {
 	uint32_t cid = target->getID();
-	if (!knownCreatureSet.contains(cid)) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -6452,7 +6541,7 @@ void ProtocolGame::sendPartyCreatureSkull(std::shared_ptr<Creature> target) {
 	}
 
 	uint32_t cid = target->getID();
-	if (!knownCreatureSet.contains(cid)) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -6466,7 +6555,7 @@ void ProtocolGame::sendPartyCreatureSkull(std::shared_ptr<Creature> target) {
 
 void ProtocolGame::sendPartyCreatureHealth(std::shared_ptr<Creature> target, uint8_t healthPercent) {
 	uint32_t cid = target->getID();
-	if (!knownCreatureSet.contains(cid)) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -6480,7 +6569,7 @@ void ProtocolGame::sendPartyCreatureHealth(std::shared_ptr<Creature> target, uin
 
 void ProtocolGame::sendPartyPlayerMana(std::shared_ptr<Player> target, uint8_t manaPercent) {
 	uint32_t cid = target->getID();
-	if (!knownCreatureSet.contains(cid)) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 	}
 
@@ -6498,7 +6587,7 @@ void ProtocolGame::sendPartyPlayerMana(std::shared_ptr<Player> target, uint8_t m
 
 void ProtocolGame::sendPartyCreatureShowStatus(std::shared_ptr<Creature> target, bool showStatus) {
 	uint32_t cid = target->getID();
-	if (!knownCreatureSet.contains(cid)) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 	}
 
@@ -6520,7 +6609,7 @@ void ProtocolGame::sendPartyPlayerVocation(std::shared_ptr<Player> target) {
 	}
 
 	uint32_t cid = target->getID();
-	if (!knownCreatureSet.contains(cid)) {
+	if (!knownCreatures.contains(cid)) {
 		sendPartyCreatureUpdate(target);
 		return;
 	}
@@ -7617,6 +7706,9 @@ void ProtocolGame::AddCreature(NetworkMessage &msg, std::shared_ptr<Creature> cr
 	CreatureType_t creatureType = creature->getType();
 	std::shared_ptr<Player> otherPlayer = creature->getPlayer();
 
+	// This carries the current health and speed, so earlier updates must not be rewritten past it
+	forgetCoalescedPackets(creature->getID());
+
 	if (known) {
 		msg.add<uint16_t>(0x62);
 		msg.add<uint32_t>(creature->getID());
@@ -8467,7 +8559,7 @@ void ProtocolGame::reloadCreature(std::shared_ptr<Creature> creature) {
 
 	NetworkMessage msg;
 
-	if (knownCreatureSet.contains(creature->getID())) {
+	if (knownCreatures.contains(creature->getID())) {
 		msg.addByte(0x6B);
 		msg.addPosition(creature->getPosition());
 		msg.addByte(static_cast<uint8_t>(stackpos));
@@ -10,6 +10,8 @@
 #pragma once
 
 #include "server/network/protocol/protocol.hpp"
+#include "server/network/protocol/known_creatures.hpp"
+#include "server/network/message/networkmessage.hpp"
 #include "creatures/interactions/chat.hpp"
 #include "creatures/creature.hpp"
 #include "enums/forge_conversion.hpp"
@@ -68,7 +70,12 @@ public:
 
 	explicit ProtocolGame(Connection_ptr initConnection);
 
-	void login(const std::string &name, uint32_t accnumber, OperatingSystem_t operatingSystem);
+	/**
+	 * @brief Places the authenticated character into the game, runs on the dispatcher.
+	 * @param namelocked Result of the namelock lookup done by the login task.
+	 * @param accountBanMessage Disconnect reason if the account is banned, empty otherwise; ignored for players that cannot be banned.
+	 */
+	void login(const std::string &name, uint32_t accnumber, OperatingSystem_t operatingSystem, bool namelocked, const std::string &accountBanMessage);
 	void logout(bool displayEffect, bool forced);
 
 	void AddItem(NetworkMessage &msg, std::shared_ptr<Item> item);
@@ -84,7 +91,26 @@ private:
 	}
 	void connect(const std::string &playerName, OperatingSystem_t operatingSystem);
 	void disconnectClient(const std::string &message) const;
+
+	// State updates where only the latest value matters within a flush window
+	enum class CoalescedPacket_t : uint8_t {
+		Stats,
+		Skills,
+		Speed,
+		Health,
+	};
+
 	void writeToOutputBuffer(const NetworkMessage &msg);
+	/**
+	 * @brief Writes a state update, replacing in place the previous one of the same kind still waiting in the output buffer.
+	 *
+	 * The replaced update keeps its position, so the packet order seen by the client doesn't change.
+	 */
+	void writeToOutputBuffer(const NetworkMessage &msg, CoalescedPacket_t type, uint32_t creatureId = 0);
+	// Stops coalescing the speed and health updates of a creature written so far, see AddCreature
+	void forgetCoalescedPackets(uint32_t creatureId);
+	// Large replies (market, highscores, cyclopedia), sent in their own message but in write order
+	void writeToBulkOutputBuffer(const NetworkMessage &msg);
 
 	void release() override;
 
@@ -283,10 +309,13 @@ private:
 
 	void sendAllowBugReport();
 	void sendDistanceShoot(const Position &from, const Position &to, uint16_t type);
+	void sendDistanceShoot(const Position &from, const Position &to, uint16_t type, SharedNetworkMessage &message);
 	void sendMagicEffect(const Position &pos, uint16_t type);
+	void sendMagicEffect(const Position &pos, uint16_t type, SharedNetworkMessage &message);
 	void removeMagicEffect(const Position &pos, uint16_t type);
 	void sendRestingStatus(uint8_t protection);
 	void sendCreatureHealth(std::shared_ptr<Creature> creature);
+	void sendCreatureHealth(std::shared_ptr<Creature> creature, SharedNetworkMessage &message);
 	void sendPartyCreatureUpdate(std::shared_ptr<Creature> target);
 	void sendPartyCreatureShield(std::shared_ptr<Creature> target);
 	void sendPartyCreatureSkull(std::shared_ptr<Creature> target);
@@ -300,12 +329,14 @@ private:
 	void sendPingBack();
 	void sendCreatureTurn(std::shared_ptr<Creature> creature, uint32_t stackpos);
 	void sendCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses type, const std::string &text, const Position* pos = nullptr);
+	void sendCreatureSay(std::shared_ptr<Creature> creature, SpeakClasses type, const std::string &text, const Position* pos, SharedNetworkMessage &message);
 
 	// Unjust Panel
 	void sendUnjustifiedPoints(const uint8_t &dayProgress, const uint8_t &dayLeft, const uint8_t &weekProgress, const uint8_t &weekLeft, const uint8_t &monthProgress, const uint8_t &monthLeft, const uint8_t &skullDuration);
 
 	void sendCancelWalk();
 	void sendChangeSpeed(std::shared_ptr<Creature> creature, uint16_t speed);
+	void sendChangeSpeed(std::shared_ptr<Creature> creature, uint16_t speed, SharedNetworkMessage &message);
 	void sendCancelTarget();
 	void sendCreatureOutfit(std::shared_ptr<Creature> creature, const Outfit_t &outfit);
 	void sendStats();
@@ -441,6 +472,12 @@ private:
 
 	void AddCreature(NetworkMessage &msg, std::shared_ptr<Creature> creature, bool known, uint32_t remove);
 	void AddPlayerStats(NetworkMessage &msg);
+	// Encoders of the packets that can be shared between viewers, see SharedNetworkMessage
+	void AddDistanceShoot(NetworkMessage &msg, const Position &from, const Position &to, uint16_t type) const;
+	void AddMagicEffect(NetworkMessage &msg, const Position &pos, uint16_t type) const;
+	void AddCreatureHealth(NetworkMessage &msg, const std::shared_ptr<Creature> &creature) const;
+	void AddCreatureSay(NetworkMessage &msg, const std::shared_ptr<Creature> &creature, SpeakClasses type, const std::string &text, const Position* pos) const;
+	void AddChangeSpeed(NetworkMessage &msg, const std::shared_ptr<Creature> &creature, uint16_t speed) const;
 	void AddOutfit(NetworkMessage &msg, const Outfit_t &outfit, bool addMount = true);
 	void AddPlayerSkills(NetworkMessage &msg);
 	void sendBlessStatus();
@@ -485,9 +522,16 @@ private:
 	friend class PlayerWheel;
 	friend class PlayerVIP;
 
-	std::unordered_set<uint32_t> knownCreatureSet;
+	KnownCreatures knownCreatures;
 	std::shared_ptr<Player> player = nullptr;
 
+	struct CoalescedPacket {
+		NetworkMessage::MsgSize_t position = 0;
+		NetworkMessage::MsgSize_t length = 0;
+	};
+	phmap::flat_hash_map<uint64_t, CoalescedPacket> coalescedPackets;
+	uint32_t coalescedBufferId = 0;
+
 	uint32_t eventConnect = 0;
 	uint32_t challengeTimestamp = 0;
 	uint16_t version = 0;
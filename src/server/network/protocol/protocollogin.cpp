@@ -140,24 +140,11 @@ void ProtocolLogin::onRecvFirstMessage(NetworkMessage &msg) {
 		return;
 	}
 
-	BanInfo banInfo;
 	auto curConnection = getConnection();
 	if (!curConnection) {
 		return;
 	}
 
-	if (IOBan::isIpBanned(curConnection->getIP(), banInfo)) {
-		if (banInfo.reason.empty()) {
-			banInfo.reason = "(none)";
-		}
-
-		std::ostringstream ss;
-		ss << "Your IP has been banned until " << formatDateShort(banInfo.expiresAt) << " by " << banInfo.bannedBy << ".\n\nReason specified:\n"
-		   << banInfo.reason;
-		disconnectClient(ss.str());
-		return;
-	}
-
 	std::string accountDescriptor = msg.getString();
 	if (accountDescriptor.empty()) {
 		std::ostringstream ss;
@@ -172,10 +159,21 @@ void ProtocolLogin::onRecvFirstMessage(NetworkMessage &msg) {
 		return;
 	}
 
-	g_dispatcher().addEvent(
-		[self = std::static_pointer_cast<ProtocolLogin>(shared_from_this()), accountDescriptor, password] {
-			self->getCharacterList(accountDescriptor, password);
-		},
-		__FUNCTION__
-	);
+	// The ban lookup, account load and Argon2 check block on the database, keep them off the network and game threads
+	addLoginTask([self = std::static_pointer_cast<ProtocolLogin>(shared_from_this()), ip = curConnection->getIP(), accountDescriptor, password] {
+		BanInfo banInfo;
+		if (IOBan::isIpBanned(ip, banInfo)) {
+			if (banInfo.reason.empty()) {
+				banInfo.reason = "(none)";
+			}
+
+			std::ostringstream ss;
+			ss << "Your IP has been banned until " << formatDateShort(banInfo.expiresAt) << " by " << banInfo.bannedBy << ".\n\nReason specified:\n"
+			   << banInfo.reason;
+			self->disconnectClient(ss.str());
+			return;
+		}
+
+		self->getCharacterList(accountDescriptor, password);
+	});
 }
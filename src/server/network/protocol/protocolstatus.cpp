@@ -20,23 +20,83 @@ std::string ProtocolStatus::SERVER_NAME = "Canary";
 std::string ProtocolStatus::SERVER_VERSION = "3.0";
 std::string ProtocolStatus::SERVER_DEVELOPERS = "OpenTibiaBR Organization";
 
-std::map<uint32_t, int64_t> ProtocolStatus::ipConnectMap;
 const uint64_t ProtocolStatus::start = OTSYS_TIME(true);
 
+namespace {
+	/**
+	 * @brief Last query time of each IP, kept in two buckets as wide as the timeout.
+	 *
+	 * When the current bucket gets older than the timeout it becomes the previous
+	 * one and the old previous bucket is dropped, so only the IPs seen in the last
+	 * two timeouts are remembered.
+	 */
+	class StatusRateLimiter {
+	public:
+		// Returns false if the IP already queried within the timeout, otherwise records the query
+		bool tryQuery(uint32_t ip, bool limited, int64_t now, int64_t timeout) {
+			std::scoped_lock lock(mutex);
+			if (now >= currentStart + timeout) {
+				if (now >= currentStart + timeout * 2) {
+					previous.clear();
+				} else {
+					previous.swap(current);
+				}
+				current.clear();
+				currentStart = now;
+			}
+
+			if (limited) {
+				const auto lastQuery = getLastQuery(ip);
+				if (lastQuery && now < *lastQuery + timeout) {
+					return false;
+				}
+			}
+
+			current.insert_or_assign(ip, now);
+			return true;
+		}
+
+	private:
+		std::optional<int64_t> getLastQuery(uint32_t ip) const {
+			if (auto it = current.find(ip); it != current.end()) {
+				return it->second;
+			}
+			if (auto it = previous.find(ip); it != previous.end()) {
+				return it->second;
+			}
+			return std::nullopt;
+		}
+
+		std::mutex mutex;
+		phmap::flat_hash_map<uint32_t, int64_t> current;
+		phmap::flat_hash_map<uint32_t, int64_t> previous;
+		int64_t currentStart = 0;
+	};
+
+	StatusRateLimiter rateLimiter;
+
+	// Only used from the dispatcher thread
+	struct CachedResponse {
+		std::string data;
+		int64_t refreshedAt = 0;
+	};
+
+	CachedResponse statusXml;
+	CachedResponse playersList;
+}
+
 void ProtocolStatus::onRecvFirstMessage(NetworkMessage &msg) {
 	uint32_t ip = getIP();
+	bool limited = false;
 	if (ip != 0x0100007F) {
 		std::string ipStr = convertIPToString(ip);
-		if (ipStr != g_configManager().getString(IP)) {
-			std::map<uint32_t, int64_t>::const_iterator it = ipConnectMap.find(ip);
-			if (it != ipConnectMap.end() && (OTSYS_TIME() < (it->second + g_configManager().getNumber(STATUSQUERY_TIMEOUT)))) {
-				disconnect();
-				return;
-			}
-		}
+		limited = ipStr != g_configManager().getString(IP);
 	}
 
-	ipConnectMap[ip] = OTSYS_TIME();
+	if (!rateLimiter.tryQuery(ip, limited, OTSYS_TIME(), g_configManager().getNumber(STATUSQUERY_TIMEOUT))) {
+		disconnect();
+		return;
+	}
 
 	switch (msg.getByte()) {
 		// XML info protocol
@@ -81,6 +141,18 @@ void ProtocolStatus::sendStatusString() {
 
 	setRawMessages(true);
 
+	const auto &data = getStatusXml();
+	output->addBytes(data.c_str(), data.size());
+	send(output);
+	disconnect();
+}
+
+const std::string &ProtocolStatus::getStatusXml() {
+	const auto now = OTSYS_TIME();
+	if (!statusXml.data.empty() && now < statusXml.refreshedAt + STATUS_CACHE_TIME) {
+		return statusXml.data;
+	}
+
 	pugi::xml_document doc;
 
 	pugi::xml_node decl = doc.prepend_child(pugi::node_declaration);
@@ -106,23 +178,7 @@ void ProtocolStatus::sendStatusString() {
 	owner.append_attribute("email") = g_configManager().getString(OWNER_EMAIL).c_str();
 
 	pugi::xml_node players = tsqp.append_child("players");
-	uint32_t real = 0;
-	std::map<uint32_t, uint32_t> listIP;
-	for (const auto &[key, player] : g_game().getPlayers()) {
-		if (player->getIP() != 0) {
-			auto ip = listIP.find(player->getIP());
-			if (ip != listIP.end()) {
-				listIP[player->getIP()]++;
-				if (listIP[player->getIP()] < 5) {
-					real++;
-				}
-			} else {
-				listIP[player->getIP()] = 1;
-				real++;
-			}
-		}
-	}
-	players.append_attribute("online") = std::to_string(real).c_str();
+	players.append_attribute("online") = std::to_string(countPlayersByIP()).c_str();
 	players.append_attribute("max") = std::to_string(g_configManager().getNumber(MAX_PLAYERS)).c_str();
 	players.append_attribute("peak") = std::to_string(g_game().getPlayersRecord()).c_str();
 
@@ -154,10 +210,40 @@ void ProtocolStatus::sendStatusString() {
 	std::ostringstream ss;
 	doc.save(ss, "", pugi::format_raw);
 
-	std::string data = ss.str();
-	output->addBytes(data.c_str(), data.size());
-	send(output);
-	disconnect();
+	statusXml.data = ss.str();
+	statusXml.refreshedAt = now;
+	return statusXml.data;
+}
+
+uint32_t ProtocolStatus::countPlayersByIP() {
+	// Connected players, counting at most 4 per IP
+	uint32_t real = 0;
+	phmap::flat_hash_map<uint32_t, uint32_t> listIP;
+	for (const auto &[key, player] : g_game().getPlayers()) {
+		if (const auto ip = player->getIP(); ip != 0 && ++listIP[ip] < 5) {
+			real++;
+		}
+	}
+	return real;
+}
+
+const std::string &ProtocolStatus::getPlayersList() {
+	const auto now = OTSYS_TIME();
+	if (!playersList.data.empty() && now < playersList.refreshedAt + STATUS_CACHE_TIME) {
+		return playersList.data;
+	}
+
+	NetworkMessage msg;
+	const auto &players = g_game().getPlayers();
+	msg.add<uint32_t>(players.size());
+	for (const auto &[key, player] : players) {
+		msg.addString(player->getName());
+		msg.add<uint32_t>(player->getLevel());
+	}
+
+	playersList.data.assign(reinterpret_cast<const char*>(msg.getBuffer()) + NetworkMessage::INITIAL_BUFFER_POSITION, msg.getLength());
+	playersList.refreshedAt = now;
+	return playersList.data;
 }
 
 void ProtocolStatus::sendInfo(uint16_t requestedInfo, const std::string &characterName) {
@@ -203,13 +289,8 @@ void ProtocolStatus::sendInfo(uint16_t requestedInfo, const std::string &charact
 
 	if (requestedInfo & REQUEST_EXT_PLAYERS_INFO) {
 		output->addByte(0x21); // players info - online players list
-
-		const auto players = g_game().getPlayers();
-		output->add<uint32_t>(players.size());
-		for (const auto &it : players) {
-			output->addString(it.second->getName());
-			output->add<uint32_t>(it.second->getLevel());
-		}
+		const auto &data = getPlayersList();
+		output->addBytes(data.c_str(), data.size());
 	}
 
 	if (requestedInfo & REQUEST_PLAYER_STATUS_INFO) {
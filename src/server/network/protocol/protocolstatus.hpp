@@ -37,5 +37,10 @@ public:
 	static std::string SERVER_DEVELOPERS;
 
 private:
-	static std::map<uint32_t, int64_t> ipConnectMap;
+	// Responses are rebuilt at most once per STATUS_CACHE_TIME, however often the server is polled
+	static constexpr int64_t STATUS_CACHE_TIME = 1000;
+
+	static const std::string &getStatusXml();
+	static const std::string &getPlayersList();
+	static uint32_t countPlayersByIP();
 };
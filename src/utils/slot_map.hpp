@@ -0,0 +1,173 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+
+#pragma once
+
+#include <deque>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// slot_map hands out ids made of a slot index and the generation of the slot,
+// starting at FirstId. Looking an id up is an array access, an id whose slot
+// was freed or reused no longer matches its generation and finds nothing.
+// The values are kept packed for iteration, in no particular order.
+// A slot is retired once its generation runs out, so an id is never handed out twice.
+// Not thread-safe.
+
+namespace stdext {
+	template <typename T, uint32_t FirstId, uint8_t IndexBits, uint8_t GenerationBits>
+	class slot_map {
+	public:
+		static_assert(IndexBits + GenerationBits <= 31, "ids must fit in the range after FirstId");
+
+		static constexpr uint32_t MAX_SLOTS = 1u << IndexBits;
+		static constexpr uint32_t MAX_GENERATION = (1u << GenerationBits) - 1;
+		static constexpr uint32_t LAST_ID = FirstId + ((MAX_GENERATION << IndexBits) | (MAX_SLOTS - 1));
+
+		static constexpr bool contains_id(uint32_t id) {
+			return id >= FirstId && id <= LAST_ID;
+		}
+
+		// Reserves a slot and returns its id, or 0 if every slot is in use or retired
+		uint32_t allocate() {
+			if (!freeSlots.empty()) {
+				const uint32_t index = freeSlots.front();
+				freeSlots.pop_front();
+				auto &slot = slots[index];
+				++slot.generation;
+				slot.reserved = true;
+				return makeId(index, slot.generation);
+			}
+
+			if (slots.size() >= MAX_SLOTS) {
+				return 0;
+			}
+
+			slots.emplace_back().reserved = true;
+			return makeId(static_cast<uint32_t>(slots.size() - 1), 0);
+		}
+
+		// Stores a value under an allocated id; an id that was erased can be set again until its slot is reused
+		bool set(uint32_t id, std::shared_ptr<T> value) {
+			auto slot = findSlot(id);
+			if (!slot) {
+				return false;
+			}
+
+			if (slot->valueIndex != NONE) {
+				values[slot->valueIndex] = std::move(value);
+				return true;
+			}
+
+			if (!slot->reserved) {
+				// Erased but not reused yet, take it back from the free list
+				std::erase(freeSlots, indexOf(id));
+				slot->reserved = true;
+			}
+
+			slot->valueIndex = static_cast<uint32_t>(values.size());
+			values.emplace_back(std::move(value));
+			valueSlots.emplace_back(indexOf(id));
+			return true;
+		}
+
+		bool erase(uint32_t id) {
+			auto slot = findSlot(id);
+			if (!slot || !slot->reserved) {
+				return false;
+			}
+
+			if (slot->valueIndex != NONE) {
+				// Move the last value into the hole
+				const uint32_t hole = slot->valueIndex;
+				values[hole] = std::move(values.back());
+				valueSlots[hole] = valueSlots.back();
+				slots[valueSlots[hole]].valueIndex = hole;
+				values.pop_back();
+				valueSlots.pop_back();
+				slot->valueIndex = NONE;
+			}
+
+			slot->reserved = false;
+			if (slot->generation < MAX_GENERATION) {
+				freeSlots.emplace_back(indexOf(id));
+			}
+			return true;
+		}
+
+		std::shared_ptr<T> get(uint32_t id) const {
+			const auto slot = findSlot(id);
+			if (!slot || slot->valueIndex == NONE) {
+				return nullptr;
+			}
+			return values[slot->valueIndex];
+		}
+
+		size_t size() const noexcept {
+			return values.size();
+		}
+
+		bool empty() const noexcept {
+			return values.empty();
+		}
+
+		auto begin() const noexcept {
+			return values.begin();
+		}
+
+		auto end() const noexcept {
+			return values.end();
+		}
+
+	private:
+		static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+		struct Slot {
+			uint32_t generation = 0;
+			uint32_t valueIndex = NONE;
+			bool reserved = false;
+		};
+
+		static uint32_t makeId(uint32_t index, uint32_t generation) {
+			return FirstId + ((generation << IndexBits) | index);
+		}
+
+		static uint32_t indexOf(uint32_t id) {
+			return (id - FirstId) & (MAX_SLOTS - 1);
+		}
+
+		static uint32_t generationOf(uint32_t id) {
+			return (id - FirstId) >> IndexBits;
+		}
+
+		const Slot* findSlot(uint32_t id) const {
+			if (!contains_id(id)) {
+				return nullptr;
+			}
+
+			const uint32_t index = indexOf(id);
+			if (index >= slots.size() || slots[index].generation != generationOf(id)) {
+				return nullptr;
+			}
+			return &slots[index];
+		}
+
+		Slot* findSlot(uint32_t id) {
+			return const_cast<Slot*>(std::as_const(*this).findSlot(id));
+		}
+
+		std::vector<Slot> slots;
+		// Reused oldest first, so a slot goes through its generations as slowly as possible
+		std::deque<uint32_t> freeSlots;
+		std::vector<std::shared_ptr<T>> values;
+		std::vector<uint32_t> valueSlots;
+	};
+}
@@ -31,18 +31,44 @@ public:
 
 	KVMemory &reset() {
 		flush();
+		backend.clear();
+		loadCount = 0;
+		saveCount = 0;
+		failSaves = false;
 		return *this;
 	}
 
+	// Simulates the persisted values, counting every single key load and save
+	std::map<std::string, ValueWrapper> backend;
+	size_t loadCount = 0;
+	size_t saveCount = 0;
+	// Makes every save fail, as with the database down
+	bool failSaves = false;
+
 protected:
 	std::vector<std::string> loadPrefix(const std::string &prefix = "") override {
-		return {};
+		std::vector<std::string> keys;
+		for (const auto &[key, value] : backend) {
+			if (key.starts_with(prefix)) {
+				keys.emplace_back(key.substr(prefix.size()));
+			}
+		}
+		return keys;
 	}
 	std::optional<ValueWrapper> load(const std::string &key) override {
+		++loadCount;
+		if (auto it = backend.find(key); it != backend.end()) {
+			return it->second;
+		}
 		return std::nullopt;
 	}
 	bool save(const std::string &key, const ValueWrapper &value) override {
-		return false;
+		++saveCount;
+		if (failSaves) {
+			return false;
+		}
+		backend.insert_or_assign(key, value);
+		return true;
 	}
 };
 
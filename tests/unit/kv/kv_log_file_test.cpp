@@ -0,0 +1,147 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "kv/kv_log_file.hpp"
+#include "injection_fixture.hpp"
+
+namespace {
+	std::filesystem::path tempLogPath(const std::string &name) {
+		const auto path = std::filesystem::temp_directory_path() / "canary_kv_log_test" / (name + ".log");
+		std::filesystem::remove(path);
+		return path;
+	}
+
+	std::string getData(KVLogFile &file, const std::string &key) {
+		auto value = file.get(key);
+		return value ? value->data : "";
+	}
+}
+
+suite<"kv_log_file"> kvLogFileTest = [] {
+	InjectionFixture injectionFixture {};
+
+	test("Put, get and erase values") = [] {
+		KVLogFile file;
+		expect(file.open(tempLogPath("put")) >> fatal);
+		expect(file.put("a", "first", 1));
+		expect(file.put("a", "second", 2));
+		expect(file.put("b", "other", 3));
+		expect(eq(getData(file, "a"), std::string("second")));
+		expect(eq(file.get("a")->timestamp, uint64_t { 2 }));
+
+		expect(file.erase("b"));
+		expect(!file.get("b").has_value());
+		expect(eq(file.size(), size_t { 1 }));
+	};
+
+	test("Reopening rebuilds the index from the file") = [] {
+		const auto path = tempLogPath("reopen");
+		{
+			KVLogFile file;
+			expect(file.open(path) >> fatal);
+			file.put("player.1.a", "1", 1);
+			file.put("player.1.b", "2", 1);
+			file.put("player.1.a", "3", 2);
+			file.erase("player.1.b");
+		}
+
+		KVLogFile file;
+		expect(file.open(path) >> fatal);
+		expect(eq(getData(file, "player.1.a"), std::string("3")));
+		expect(!file.get("player.1.b").has_value());
+	};
+
+	test("Keys are listed by prefix in order") = [] {
+		KVLogFile file;
+		expect(file.open(tempLogPath("keys")) >> fatal);
+		file.put("scope.b", "", 1);
+		file.put("scope.a", "", 1);
+		file.put("scopeless", "", 1);
+		file.put("other.a", "", 1);
+		expect(file.keys("scope.") == std::vector<std::string> { "scope.a", "scope.b" });
+		expect(eq(file.scan("scope.").size(), size_t { 2 }));
+	};
+
+	test("A damaged tail is discarded") = [] {
+		const auto path = tempLogPath("damaged");
+		{
+			KVLogFile file;
+			expect(file.open(path) >> fatal);
+			file.put("a", "kept", 1);
+		}
+		{
+			std::ofstream output(path, std::ios::binary | std::ios::app);
+			output << "partial record";
+		}
+
+		KVLogFile file;
+		expect(file.open(path) >> fatal);
+		expect(eq(getData(file, "a"), std::string("kept")));
+		expect(file.put("b", "after", 2));
+		expect(eq(getData(file, "b"), std::string("after")));
+	};
+
+	test("Compaction keeps only the live values") = [] {
+		const auto path = tempLogPath("compact");
+		KVLogFile file;
+		expect(file.open(path) >> fatal);
+		for (int i = 0; i < 100; ++i) {
+			file.put("a", fmt::format("value {}", i), i);
+		}
+		file.put("b", "removed", 1);
+		file.erase("b");
+		expect(file.sync());
+
+		const auto sizeBefore = std::filesystem::file_size(path);
+		expect(file.compact() >> fatal);
+		expect(lt(std::filesystem::file_size(path), sizeBefore));
+		expect(eq(getData(file, "a"), std::string("value 99")));
+		expect(!file.get("b").has_value());
+
+		file.close();
+		expect(file.open(path) >> fatal);
+		expect(eq(getData(file, "a"), std::string("value 99")));
+		expect(eq(file.size(), size_t { 1 }));
+	};
+
+	test("Writes made while compacting are kept") = [] {
+		const auto path = tempLogPath("compact_concurrent");
+		KVLogFile file;
+		expect(file.open(path) >> fatal);
+		for (int i = 0; i < 1000; ++i) {
+			file.put(fmt::format("key {}", i), "old", 0);
+		}
+
+		std::atomic<bool> compacting = true;
+		std::thread writer([&file, &compacting] {
+			for (int round = 1; compacting; ++round) {
+				file.put(fmt::format("key {}", round % 1000), fmt::format("round {}", round), round);
+				file.erase(fmt::format("key {}", (round + 500) % 1000));
+			}
+		});
+		for (int i = 0; i < 10; ++i) {
+			expect(file.compact());
+		}
+		compacting = false;
+		writer.join();
+
+		const auto before = file.scan("key ");
+		file.close();
+		expect(file.open(path) >> fatal);
+		const auto after = file.scan("key ");
+		expect(eq(after.size(), before.size()) >> fatal);
+		for (size_t i = 0; i < after.size(); ++i) {
+			expect(eq(after[i].first, before[i].first));
+			expect(eq(after[i].second.data, before[i].second.data));
+		}
+	};
+};
@@ -125,4 +125,120 @@ suite<"kv"> kvTest = [] {
 			  kv.remove("key2");
 			  expect(!kv.get("key2").has_value());
 		  };
+
+	test("Missing keys are loaded only once") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		expect(!kv.get("missing").has_value());
+		expect(!kv.get("missing").has_value());
+		expect(eq(kv.loadCount, 1));
+
+		kv.set("missing", 1);
+		expect(eq(kv.get("missing")->get<int>(), 1));
+		expect(eq(kv.loadCount, 1));
+	};
+
+	test("Force load skips the negative cache") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		expect(!kv.get("late").has_value());
+		kv.backend.insert_or_assign("late", ValueWrapper(7));
+		expect(!kv.get("late").has_value());
+		expect(eq(kv.get("late", true)->get<int>(), 7));
+	};
+
+	test("Prefetch loads a whole scope") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.backend.insert_or_assign("player.1.a", ValueWrapper(1));
+		kv.backend.insert_or_assign("player.1.b", ValueWrapper(2));
+		kv.backend.insert_or_assign("player.10.a", ValueWrapper(3));
+		kv.prefetch("player.1");
+
+		const auto loadsAfterPrefetch = kv.loadCount;
+		expect(eq(kv.get("player.1.a")->get<int>(), 1));
+		expect(eq(kv.scoped("player")->scoped("1")->get("b")->get<int>(), 2));
+		expect(!kv.get("player.1.missing").has_value());
+		expect(!kv.get("player.1.nested.missing").has_value());
+		expect(eq(kv.loadCount, loadsAfterPrefetch));
+
+		// Not part of the prefetched scope
+		expect(eq(kv.get("player.10.a")->get<int>(), 3));
+		expect(eq(kv.loadCount, loadsAfterPrefetch + 1));
+	};
+
+	test("Prefetch keeps values changed in memory") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.backend.insert_or_assign("player.2.a", ValueWrapper(1));
+		kv.backend.insert_or_assign("player.2.b", ValueWrapper(2));
+		kv.set("player.2.a", 5);
+		kv.remove("player.2.b");
+		kv.prefetch("player.2");
+		expect(eq(kv.get("player.2.a")->get<int>(), 5));
+		expect(!kv.get("player.2.b").has_value());
+	};
+
+	test("Save writes only changed entries") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.set("saved.a", 1);
+		kv.set("saved.b", 2);
+		expect(kv.saveAll());
+		expect(eq(kv.saveCount, 2));
+		expect(eq(kv.backend.at("saved.b").get<int>(), 2));
+
+		expect(eq(kv.get("saved.a")->get<int>(), 1));
+		expect(kv.saveAll());
+		expect(eq(kv.saveCount, 2));
+
+		kv.set("saved.a", 3);
+		expect(kv.saveAll());
+		expect(eq(kv.saveCount, 3));
+		expect(eq(kv.backend.at("saved.a").get<int>(), 3));
+	};
+
+	test("A failed save is retried on the next one") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.set("retried", 1);
+		kv.failSaves = true;
+		expect(!kv.saveAll());
+		expect(!kv.backend.contains("retried"));
+
+		kv.failSaves = false;
+		expect(kv.saveAll());
+		expect(eq(kv.backend.at("retried").get<int>(), 1));
+		expect(kv.saveAll());
+		expect(eq(kv.saveCount, 2));
+	};
+
+	test("Loaded values are not saved back") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.backend.insert_or_assign("loaded", ValueWrapper(1));
+		expect(eq(kv.get("loaded")->get<int>(), 1));
+		kv.prefetch("loaded");
+		expect(kv.saveAll());
+		expect(eq(kv.saveCount, 0));
+	};
+
+	test("Keys are listed in order") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.set("list.b", 2);
+		kv.set("list.c", 3);
+		kv.set("list.a", 1);
+		kv.backend.insert_or_assign("list.d", ValueWrapper(4));
+		const auto keys = kv.keys("list.");
+		expect(std::vector<std::string>(keys.begin(), keys.end()) == std::vector<std::string> { "a", "b", "c", "d" });
+	};
+
+	test("Listing a scope again is served from memory") = [&injectionFixture] {
+		auto [kv] = injectionFixture.get<KVStore>();
+		kv.backend.insert_or_assign("scope.1.x", ValueWrapper(1));
+		kv.backend.insert_or_assign("scope.1.y", ValueWrapper(2));
+		expect(eq(kv.scoped("scope")->scoped("1")->keys().size(), 2));
+
+		const auto loadsAfterListing = kv.loadCount;
+		kv.backend.insert_or_assign("scope.1.unseen", ValueWrapper(3));
+		kv.set("scope.1.z", 3);
+		kv.remove("scope.1.x");
+		const auto keys = kv.keys("scope.1.");
+		expect(std::vector<std::string>(keys.begin(), keys.end()) == std::vector<std::string> { "y", "z" });
+		expect(eq(kv.get("scope.1.y")->get<int>(), 2));
+		expect(eq(kv.loadCount, loadsAfterListing));
+	};
 };
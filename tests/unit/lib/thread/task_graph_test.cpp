@@ -0,0 +1,77 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "lib/di/container.hpp"
+#include "lib/thread/task_graph.hpp"
+#include "lib/logging/in_memory_logger.hpp"
+
+using namespace boost::ut;
+
+suite<"lib"> taskGraphTest = [] {
+	test("TaskGraph runs dependencies before their dependents") = [] {
+		di::extension::injector<> injector {};
+		DI::setTestContainer(&InMemoryLogger::install(injector));
+		ThreadPool threadPool { injector.create<Logger &>() };
+
+		std::mutex orderMutex;
+		std::vector<std::string> order;
+		auto record = [&](const std::string &name) {
+			return [&, name] {
+				std::scoped_lock lock(orderMutex);
+				order.emplace_back(name);
+				return true;
+			};
+		};
+
+		TaskGraph graph(threadPool);
+		graph.add("a", record("a"));
+		graph.add("b", record("b"));
+		graph.add("c", record("c"), { "a", "b" });
+		graph.add("d", record("d"), { "c" });
+
+		expect(graph.run().empty());
+		expect(eq(order.size(), 4) >> fatal);
+		expect(eq(order[2], std::string { "c" }));
+		expect(eq(order[3], std::string { "d" }));
+	};
+
+	test("TaskGraph skips the dependents of a failed task") = [] {
+		di::extension::injector<> injector {};
+		DI::setTestContainer(&InMemoryLogger::install(injector));
+		ThreadPool threadPool { injector.create<Logger &>() };
+
+		std::atomic_bool dependentRan = false;
+		std::atomic_bool independentRan = false;
+
+		TaskGraph graph(threadPool);
+		graph.add("failing", [] { return false; });
+		graph.add("throwing", []() -> bool { throw std::runtime_error("boom"); });
+		graph.add("dependent", [&] { return dependentRan = true; }, { "failing" });
+		graph.add("independent", [&] { return independentRan = true; });
+
+		const auto failed = graph.run();
+		expect(eq(failed.size(), 2) >> fatal);
+		expect(eq(failed[0], std::string { "failing" }));
+		expect(eq(failed[1], std::string { "throwing" }));
+		expect(!dependentRan);
+		expect(independentRan.load());
+	};
+
+	test("TaskGraph rejects unknown dependencies") = [] {
+		di::extension::injector<> injector {};
+		DI::setTestContainer(&InMemoryLogger::install(injector));
+		ThreadPool threadPool { injector.create<Logger &>() };
+
+		TaskGraph graph(threadPool);
+		expect(throws<std::invalid_argument>([&] { graph.add("a", [] { return true; }, { "missing" }); }));
+	};
+};
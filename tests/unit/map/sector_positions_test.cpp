@@ -0,0 +1,90 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "map/utils/mapsector.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	struct RangeQuery {
+		Position center;
+		bool multifloor;
+	};
+
+	// The per-creature check Spectators::find did before the positions were packed
+	bool isInRange(const Position &pos, const Position &center, int32_t minX, int32_t minY, uint8_t minZ, uint32_t width, uint32_t height, uint32_t depth) {
+		if (static_cast<uint32_t>(static_cast<int32_t>(pos.z) - minZ) > depth) {
+			return false;
+		}
+		const int_fast16_t offsetZ = Position::getOffsetZ(center, pos);
+		return static_cast<uint32_t>(pos.x - offsetZ - minX) <= width && static_cast<uint32_t>(pos.y - offsetZ - minY) <= height;
+	}
+}
+
+suite<"map"> sectorPositionsTest = [] {
+	test("findInRange matches the per-creature check for 50 to 500 creatures") = [] {
+		std::mt19937 rng(7);
+		std::uniform_int_distribution<int> coordinate(960, 1040);
+		std::uniform_int_distribution<int> floor(3, 11);
+
+		const std::vector<RangeQuery> queries {
+			{ Position(1000, 1000, 7), false },
+			{ Position(1000, 1000, 7), true },
+			{ Position(990, 1020, 9), true },
+			{ Position(1035, 965, 4), true },
+		};
+
+		for (size_t count = 50; count <= 500; count += 50) {
+			SectorPositions positions;
+			std::vector<Position> list;
+			for (size_t i = 0; i < count; ++i) {
+				const Position pos(coordinate(rng), coordinate(rng), floor(rng));
+				positions.add(pos);
+				list.emplace_back(pos);
+			}
+
+			for (const auto &[center, multifloor] : queries) {
+				const int32_t minX = center.x - MAP_MAX_VIEW_PORT_X;
+				const int32_t minY = center.y - MAP_MAX_VIEW_PORT_Y;
+				const uint8_t minZ = multifloor ? center.z - 2 : center.z;
+				const uint32_t depth = multifloor ? 4 : 0;
+				const uint32_t width = MAP_MAX_VIEW_PORT_X * 2;
+				const uint32_t height = MAP_MAX_VIEW_PORT_Y * 2;
+
+				std::vector<uint32_t> expected;
+				for (uint32_t i = 0; i < list.size(); ++i) {
+					if (isInRange(list[i], center, minX, minY, minZ, width, height, depth)) {
+						expected.emplace_back(i);
+					}
+				}
+
+				std::vector<uint32_t> indexes;
+				positions.findInRange(center.z, minX, minY, minZ, width, height, depth, indexes);
+				expect(indexes == expected) << fmt::format("{} creatures around {}", count, center.toString());
+			}
+		}
+	};
+
+	test("Removing swaps the last position into the hole") = [] {
+		SectorPositions positions;
+		positions.add(Position(100, 100, 7));
+		positions.add(Position(500, 500, 7));
+		positions.add(Position(101, 101, 7));
+		positions.swapRemove(0);
+		positions.set(1, Position(102, 102, 7));
+
+		std::vector<uint32_t> indexes;
+		positions.findInRange(7, 90, 90, 7, 20, 20, 0, indexes);
+		expect(eq(positions.size(), size_t { 2 }));
+		expect(indexes == std::vector<uint32_t> { 0, 1 });
+	};
+};
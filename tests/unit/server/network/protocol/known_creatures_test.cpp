@@ -0,0 +1,73 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "server/network/protocol/known_creatures.hpp"
+
+using namespace boost::ut;
+
+suite<"server"> knownCreaturesTest = [] {
+	test("KnownCreatures::touch reports whether the creature was known") = [] {
+		KnownCreatures knownCreatures;
+		expect(!knownCreatures.touch(1));
+		expect(knownCreatures.touch(1));
+		expect(knownCreatures.contains(1));
+		expect(eq(knownCreatures.size(), 1));
+	};
+
+	test("KnownCreatures::evict picks the least recently seen creature") = [] {
+		KnownCreatures knownCreatures;
+		knownCreatures.touch(1);
+		knownCreatures.touch(2);
+		knownCreatures.touch(3);
+		// Seen again, so 2 becomes the oldest one
+		knownCreatures.touch(1);
+
+		expect(eq(knownCreatures.evict(4, [](uint32_t) { return true; }), 2));
+		expect(!knownCreatures.contains(2));
+		expect(eq(knownCreatures.evict(4, [](uint32_t) { return true; }), 3));
+		expect(eq(knownCreatures.size(), 1));
+	};
+
+	test("KnownCreatures::evict skips creatures that must stay known") = [] {
+		KnownCreatures knownCreatures;
+		knownCreatures.touch(1);
+		knownCreatures.touch(2);
+		knownCreatures.touch(3);
+
+		expect(eq(knownCreatures.evict(3, [](uint32_t id) { return id != 1; }), 2));
+		// Nothing can be evicted, falls back to the oldest one that isn't kept
+		expect(eq(knownCreatures.evict(3, [](uint32_t) { return false; }), 1));
+		expect(eq(knownCreatures.evict(3, [](uint32_t) { return true; }), 0));
+		expect(knownCreatures.contains(3));
+	};
+
+	test("KnownCreatures keeps the client limit in a crowded scene") = [] {
+		constexpr size_t limit = 1300;
+		KnownCreatures knownCreatures;
+		for (uint32_t id = 1; id <= 10000; ++id) {
+			if (!knownCreatures.touch(id) && knownCreatures.size() > limit) {
+				// Every creature still on screen is visible, the rest left long ago
+				const auto evicted = knownCreatures.evict(id, [id](uint32_t knownId) { return id - knownId > 500; });
+				expect(neq(evicted, 0u));
+				expect(neq(evicted, id));
+			}
+			// The player keeps looking at the same few creatures
+			knownCreatures.touch(1 + (id % 10));
+		}
+
+		expect(eq(knownCreatures.size(), limit));
+		for (uint32_t id = 1; id <= 10; ++id) {
+			expect(knownCreatures.contains(id));
+		}
+		expect(knownCreatures.contains(10000));
+	};
+};
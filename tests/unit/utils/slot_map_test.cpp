@@ -0,0 +1,99 @@
+/**
+ * Canary - A free and open-source MMORPG server emulator
+ * Copyright (©) 2019-2024 OpenTibiaBR <opentibiabr@outlook.com>
+ * Repository: https://github.com/opentibiabr/canary
+ * License: https://github.com/opentibiabr/canary/blob/main/LICENSE
+ * Contributors: https://github.com/opentibiabr/canary/graphs/contributors
+ * Website: https://docs.opentibiabr.com/
+ */
+#include "pch.hpp"
+
+#include <boost/ut.hpp>
+
+#include "utils/slot_map.hpp"
+
+using namespace boost::ut;
+
+namespace {
+	using TestSlotMap = stdext::slot_map<int, 100, 2, 2>;
+}
+
+suite<"utils"> slotMapTest = [] {
+	test("Ids are found until they are erased") = [] {
+		TestSlotMap map;
+		const auto first = map.allocate();
+		const auto second = map.allocate();
+		expect(map.set(first, std::make_shared<int>(1)));
+		expect(map.set(second, std::make_shared<int>(2)));
+		expect(eq(*map.get(first), 1));
+		expect(eq(*map.get(second), 2));
+		expect(eq(map.size(), size_t { 2 }));
+
+		expect(map.erase(first));
+		expect(map.get(first) == nullptr);
+		expect(eq(*map.get(second), 2));
+		expect(eq(map.size(), size_t { 1 }));
+		expect(map.get(0) == nullptr);
+		expect(map.get(TestSlotMap::LAST_ID + 1) == nullptr);
+	};
+
+	test("A reused slot doesn't answer to its stale id") = [] {
+		TestSlotMap map;
+		const auto stale = map.allocate();
+		map.set(stale, std::make_shared<int>(1));
+		map.erase(stale);
+
+		std::vector<uint32_t> ids;
+		for (int i = 0; i < 4; ++i) {
+			ids.emplace_back(map.allocate());
+		}
+		expect(std::ranges::find(ids, stale) == ids.end());
+		for (const auto id : ids) {
+			map.set(id, std::make_shared<int>(2));
+		}
+		expect(map.get(stale) == nullptr);
+		expect(!map.set(stale, std::make_shared<int>(3)));
+	};
+
+	test("An erased id can be set again until its slot is reused") = [] {
+		TestSlotMap map;
+		const auto id = map.allocate();
+		map.set(id, std::make_shared<int>(1));
+		map.erase(id);
+		expect(map.set(id, std::make_shared<int>(2)));
+		expect(eq(*map.get(id), 2));
+		expect(map.allocate() != id);
+	};
+
+	test("Ids are never handed out twice") = [] {
+		TestSlotMap map;
+		std::set<uint32_t> seen;
+		uint32_t id;
+		while ((id = map.allocate()) != 0) {
+			expect(seen.insert(id).second);
+			expect(TestSlotMap::contains_id(id));
+			map.set(id, std::make_shared<int>(0));
+			map.erase(id);
+		}
+		// Every slot went through every generation
+		expect(eq(seen.size(), size_t { TestSlotMap::MAX_SLOTS * (TestSlotMap::MAX_GENERATION + 1) }));
+	};
+
+	test("Iteration visits every value once") = [] {
+		TestSlotMap map;
+		std::vector<uint32_t> ids;
+		for (int i = 0; i < 4; ++i) {
+			ids.emplace_back(map.allocate());
+			map.set(ids.back(), std::make_shared<int>(i));
+		}
+		map.erase(ids[1]);
+
+		std::vector<int> values;
+		for (const auto &value : map) {
+			values.emplace_back(*value);
+		}
+		std::ranges::sort(values);
+		expect(values == std::vector<int> { 0, 2, 3 });
+		expect(eq(*map.get(ids[3]), 3));
+	};
+};